@@ -0,0 +1,587 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <reflect/json_writer.hpp>
+#include <reflect/json_reader.hpp>
+#include <reflect/binary_archive.hpp>
+#include <reflect/algorithms.hpp>
+#include <reflect/hash.hpp>
+#include <reflect/patch.hpp>
+#include <reflect/registry.hpp>
+#include <reflect/meta_object.hpp>
+#include <reflect/value.hpp>
+#include <reflect/batch.hpp>
+#include <reflect/soa_vector.hpp>
+#include "bench_objects.hpp"
+
+namespace
+{
+    //====================
+    // Harness
+    //====================
+    /** Sink the benchmarked values are written to, so that they cannot be optimised away. */
+    volatile std::size_t g_sink = 0;
+
+    /** The number of timed runs of each benchmark, of which the fastest is reported. */
+    const int g_runs = 5;
+
+    /** The minimum duration of a single timed run. */
+    const std::chrono::nanoseconds g_min_duration = std::chrono::milliseconds(20);
+
+    /** The maximum number of iterations of a single timed run. */
+    const std::size_t g_max_iterations = std::size_t(1) << 28;
+
+    /** The number of objects processed by each iteration of the batch benchmarks. */
+    const std::size_t g_batch_size = 1024;
+
+    struct result
+    {
+        std::string group;
+        std::string name;
+        std::size_t iterations;
+        double ns_per_op;
+    };
+
+    /**********************************************************/
+    void consume(std::size_t value)
+    {
+        g_sink = g_sink + value;
+    }
+
+    /**********************************************************/
+    void consume(const std::string& value)
+    {
+        g_sink = g_sink + value.size();
+    }
+
+    /**********************************************************/
+    void consume(bench_colour value)
+    {
+        g_sink = g_sink + static_cast<std::size_t>(value);
+    }
+
+    /**********************************************************/
+    template <typename F>
+    std::chrono::nanoseconds time_run(std::size_t iterations, F& f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            f(i);
+        }
+
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    /**
+     * Runs the function with an increasing number of iterations until a single run takes at least
+     * the minimum duration, then reports the fastest of several runs of that length. The function is
+     * passed the iteration number, which should be used to vary the input.
+     */
+    template <typename F>
+    void measure(std::vector<result>& results, const char* group, const char* name, F f)
+    {
+        std::size_t iterations = 1024;
+        while (iterations < g_max_iterations && time_run(iterations, f) < g_min_duration)
+        {
+            iterations *= 2;
+        }
+
+        std::chrono::nanoseconds best = std::chrono::nanoseconds::max();
+        for (int run = 0; run < g_runs; ++run)
+        {
+            const std::chrono::nanoseconds duration = time_run(iterations, f);
+            if (duration < best)
+            {
+                best = duration;
+            }
+        }
+
+        results.push_back({ group, name, iterations, static_cast<double>(best.count()) / static_cast<double>(iterations) });
+    }
+
+    /**********************************************************/
+    void write_json(std::ostream& stream, const std::vector<result>& results)
+    {
+        stream << "{\n  \"benchmarks\": [\n";
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            stream << "    { \"group\": \"" << results[i].group
+                   << "\", \"name\": \"" << results[i].name
+                   << "\", \"iterations\": " << results[i].iterations
+                   << ", \"ns_per_op\": " << results[i].ns_per_op
+                   << (i + 1 < results.size() ? " },\n" : " }\n");
+        }
+        stream << "  ]\n}\n";
+    }
+
+    //====================
+    // Benchmarks
+    //====================
+    const char* const g_names_4[] = { BENCH_FIELDS_4(BENCH_NAME, BENCH_COMMA, f) };
+    const char* const g_names_32[] = { BENCH_FIELDS_32(BENCH_NAME, BENCH_COMMA, f) };
+    const char* const g_names_256[] = { BENCH_FIELDS_256(BENCH_NAME, BENCH_COMMA, f) };
+
+    /**
+     * Benchmarks the name based accessors of a class, cycling through every registered name
+     * so that the lookups cannot be predicted.
+     */
+    template <typename Class, std::size_t N, typename Baseline>
+    void bench_class(std::vector<result>& results, const char* group, const char* const (&names)[N], Baseline baseline)
+    {
+        Class object;
+        reflect::meta_class<Class> data(object);
+
+        measure(results, group, "get_member", [&](std::size_t i) {
+            consume(static_cast<std::size_t>(data.template get_member<int>(names[i % N])));
+        });
+
+        measure(results, group, "try_get_member", [&](std::size_t i) {
+            int value = 0;
+            data.try_get_member(names[i % N], value);
+            consume(static_cast<std::size_t>(value));
+        });
+
+        measure(results, group, "set_member", [&](std::size_t i) {
+            data.template set_member<int>(names[i % N], static_cast<int>(i));
+        });
+
+        measure(results, group, "try_set_member", [&](std::size_t i) {
+            data.template try_set_member<int>(names[i % N], static_cast<int>(i));
+        });
+
+        const reflect::meta_object erased(object);
+        measure(results, group, "meta_object_get", [&](std::size_t i) {
+            consume(static_cast<std::size_t>(erased.get_member<int>(names[i % N])));
+        });
+
+        measure(results, group, "meta_object_get_at", [&](std::size_t i) {
+            consume(static_cast<std::size_t>(erased.get_member_at<int>(i % N)));
+        });
+
+        measure(results, group, "meta_object_set", [&](std::size_t i) {
+            erased.set_member<int>(names[i % N], static_cast<int>(i));
+        });
+
+        measure(results, group, "get_value", [&](std::size_t i) {
+            consume(static_cast<std::size_t>(data.get_value(names[i % N]).template get<int>()));
+        });
+
+        measure(results, group, "set_value", [&](std::size_t i) {
+            data.set_value(names[i % N], static_cast<int>(i));
+        });
+
+        measure(results, group, "meta_object_get_value", [&](std::size_t i) {
+            consume(static_cast<std::size_t>(erased.get_value(names[i % N]).template get<int>()));
+        });
+
+        measure(results, group, "has_member", [&](std::size_t i) {
+            consume(data.has_member(names[i % N]) ? 1 : 0);
+        });
+
+        measure(results, group, "for_each", [&](std::size_t) {
+            std::size_t sum = 0;
+            data.for_each([&sum, &object](const auto& member) {
+                sum += static_cast<std::size_t>(member.get_copy(object));
+            });
+            consume(sum);
+        });
+
+        measure(results, group, "baseline_for_each", [&](std::size_t) {
+            consume(baseline(object));
+        });
+
+        reflect::json_writer writer;
+        measure(results, group, "json_write", [&](std::size_t) {
+            writer.clear();
+            writer.write(object);
+            consume(writer.view().size());
+        });
+
+        reflect::dirty_set<Class> dirty;
+        measure(results, group, "json_write_dirty", [&](std::size_t i) {
+            dirty.mark(i % N);
+            writer.clear();
+            writer.write_dirty(object, dirty);
+            consume(writer.view().size());
+        });
+
+        writer.clear();
+        writer.write(object);
+        const std::string json = writer.str();
+        measure(results, group, "json_read", [&](std::size_t i) {
+            reflect::from_json(json, object);
+            consume(i);
+        });
+
+        reflect::binary_writer archive;
+        measure(results, group, "binary_write", [&](std::size_t) {
+            archive.clear();
+            archive.write(object);
+            consume(archive.size());
+        });
+
+        measure(results, group, "binary_read", [&](std::size_t i) {
+            reflect::binary_reader reader(archive.data(), archive.size());
+            reader.read(object);
+            consume(i);
+        });
+
+        Class copy = object;
+        measure(results, group, "copy_members", [&](std::size_t i) {
+            reflect::copy_members(object, copy);
+            consume(i);
+        });
+
+        measure(results, group, "members_equal", [&](std::size_t) {
+            consume(reflect::members_equal(object, copy) ? 1 : 0);
+        });
+
+        measure(results, group, "hash", [&](std::size_t) {
+            consume(reflect::hash(object));
+        });
+
+        // A single changed member, as in a typical replicated update.
+        reflect::meta_class<Class>(copy).template set_member<int>(names[0], data.template get_member<int>(names[0]) + 1);
+        measure(results, group, "diff", [&](std::size_t) {
+            consume(reflect::diff(object, copy).size());
+        });
+
+        const reflect::patch<Class> changes = reflect::diff(object, copy);
+        measure(results, group, "apply", [&](std::size_t i) {
+            reflect::apply(changes, object);
+            consume(i);
+        });
+    }
+
+    /**********************************************************/
+    void bench_enum(std::vector<result>& results)
+    {
+        static const char* const names[] = { "Red", "Green", "Blue", "Cyan", "Magenta", "Yellow", "Black", "White" };
+
+        bench_enum_object object;
+        reflect::meta_class<bench_enum_object> data(object);
+
+        measure(results, "enum", "to_string", [&](std::size_t i) {
+            object.set_colour(static_cast<bench_colour>(i % 8));
+            consume(data.get_enum_member_as_string<bench_colour>("colour"));
+        });
+
+        measure(results, "enum", "from_string", [&](std::size_t i) {
+            data.set_enum_member_from_string<bench_colour>("colour", names[i % 8]);
+            consume(object.get_colour());
+        });
+
+        measure(results, "enum", "baseline_to_string", [&](std::size_t i) {
+            consume(std::string(names[i % 8]));
+        });
+
+        measure(results, "enum", "baseline_from_string", [&](std::size_t i) {
+            const std::string name = names[i % 8];
+            for (std::size_t j = 0; j < 8; ++j)
+            {
+                if (name == names[j])
+                {
+                    object.set_colour(static_cast<bench_colour>(j));
+                    break;
+                }
+            }
+            consume(object.get_colour());
+        });
+    }
+
+    /**********************************************************/
+    void bench_paths(std::vector<result>& results)
+    {
+        bench_nested_object object;
+        reflect::meta_class<bench_nested_object> data(object);
+
+        measure(results, "path", "get_member/member", [&](std::size_t) {
+            consume(static_cast<std::size_t>(data.get_member<int>("outer.f2")));
+        });
+
+        measure(results, "path", "get_member/getter", [&](std::size_t) {
+            consume(static_cast<std::size_t>(data.get_member<int>("inner.f2")));
+        });
+
+        measure(results, "path", "set_member/member", [&](std::size_t i) {
+            data.set_member<int>("outer.f2", static_cast<int>(i));
+        });
+
+        const auto outer = reflect::meta_class<bench_nested_object>::resolve<int>("outer.f2");
+        measure(results, "path", "handle_get/member", [&](std::size_t) {
+            consume(static_cast<std::size_t>(outer.get(object)));
+        });
+
+        measure(results, "path", "handle_set/member", [&](std::size_t i) {
+            outer.set(object, static_cast<int>(i));
+        });
+
+        const auto inner = reflect::meta_class<bench_nested_object>::resolve<int>("inner.f2");
+        measure(results, "path", "handle_get/getter", [&](std::size_t) {
+            consume(static_cast<std::size_t>(inner.get(object)));
+        });
+
+        measure(results, "path", "baseline_get", [&](std::size_t) {
+            consume(static_cast<std::size_t>(object.outer.f2));
+        });
+    }
+
+    /**********************************************************/
+    void bench_batches(std::vector<result>& results)
+    {
+        std::vector<bench_object_32> objects(g_batch_size);
+        std::vector<bench_nested_object> nested(g_batch_size);
+        std::vector<int> values(g_batch_size);
+
+        measure(results, "batch", "gather/member", [&](std::size_t i) {
+            reflect::gather<int>(reflect::make_span(objects), "f02", values);
+            consume(static_cast<std::size_t>(values[i % g_batch_size]));
+        });
+
+        measure(results, "batch", "gather/getter", [&](std::size_t i) {
+            reflect::gather<int>(reflect::make_span(nested), "inner.f2", values);
+            consume(static_cast<std::size_t>(values[i % g_batch_size]));
+        });
+
+        measure(results, "batch", "get_member_loop", [&](std::size_t i) {
+            for (std::size_t j = 0; j < g_batch_size; ++j)
+            {
+                values[j] = reflect::meta_class<bench_object_32>(objects[j]).get_member<int>("f02");
+            }
+            consume(static_cast<std::size_t>(values[i % g_batch_size]));
+        });
+
+        measure(results, "batch", "baseline_gather", [&](std::size_t i) {
+            for (std::size_t j = 0; j < g_batch_size; ++j)
+            {
+                values[j] = objects[j].f02;
+            }
+            consume(static_cast<std::size_t>(values[i % g_batch_size]));
+        });
+
+        measure(results, "batch", "scatter/member", [&](std::size_t i) {
+            values[i % g_batch_size] = static_cast<int>(i);
+            reflect::scatter<int>(reflect::make_span(objects), "f02", values);
+            consume(static_cast<std::size_t>(objects[i % g_batch_size].f02));
+        });
+
+        measure(results, "batch", "scatter/setter", [&](std::size_t i) {
+            values[i % g_batch_size] = static_cast<int>(i);
+            reflect::scatter<int>(reflect::make_span(nested), "inner.f2", values);
+            consume(static_cast<std::size_t>(nested[i % g_batch_size].get_inner().f2));
+        });
+
+        measure(results, "batch", "set_member_loop", [&](std::size_t i) {
+            values[i % g_batch_size] = static_cast<int>(i);
+            for (std::size_t j = 0; j < g_batch_size; ++j)
+            {
+                reflect::meta_class<bench_object_32>(objects[j]).set_member<int>("f02", values[j]);
+            }
+            consume(static_cast<std::size_t>(objects[i % g_batch_size].f02));
+        });
+
+        measure(results, "batch", "baseline_scatter", [&](std::size_t i) {
+            values[i % g_batch_size] = static_cast<int>(i);
+            for (std::size_t j = 0; j < g_batch_size; ++j)
+            {
+                objects[j].f02 = values[j];
+            }
+            consume(static_cast<std::size_t>(objects[i % g_batch_size].f02));
+        });
+
+        reflect::soa_vector<bench_object_32> columns;
+        for (const bench_object_32& object : objects)
+        {
+            columns.push_back(object);
+        }
+
+        measure(results, "batch", "soa_column_sum", [&](std::size_t) {
+            std::size_t sum = 0;
+            for (int value : columns.column<int>("f02"))
+            {
+                sum += static_cast<std::size_t>(value);
+            }
+            consume(sum);
+        });
+
+        measure(results, "batch", "baseline_aos_sum", [&](std::size_t) {
+            std::size_t sum = 0;
+            for (const bench_object_32& object : objects)
+            {
+                sum += static_cast<std::size_t>(object.f02);
+            }
+            consume(sum);
+        });
+    }
+
+    /**********************************************************/
+    void bench_registry(std::vector<result>& results)
+    {
+        static const char* const names[] = { "bench_object_4", "bench_object_32", "bench_object_256", "bench_missing" };
+
+        reflect::registry::add<bench_object_4>();
+        reflect::registry::add<bench_object_32>();
+        reflect::registry::add<bench_object_256>();
+
+        measure(results, "registry", "find_name", [&](std::size_t i) {
+            consume(reflect::registry::find(names[i % 4]) != nullptr ? 1 : 0);
+        });
+
+        const std::uint64_t ids[] = { reflect::type_id<bench_object_4>(), reflect::type_id<bench_object_32>(), reflect::type_id<bench_object_256>(), 0 };
+        measure(results, "registry", "find_id", [&](std::size_t i) {
+            consume(reflect::registry::find(ids[i % 4]) != nullptr ? 1 : 0);
+        });
+
+        const reflect::meta_type& type = reflect::get_meta_type<bench_object_32>();
+        measure(results, "registry", "construct_destroy", [&](std::size_t i) {
+            type.destroy(type.construct());
+            consume(i);
+        });
+    }
+
+    /**********************************************************/
+    template <typename Property>
+    void bench_property(std::vector<result>& results, const char* name, const Property& property)
+    {
+        const std::string get_name = std::string("get_copy/") + name;
+        const std::string set_name = std::string("set/") + name;
+        const std::string handle_get_name = std::string("handle_get/") + name;
+        const std::string handle_set_name = std::string("handle_set/") + name;
+
+        bench_accessor_object object;
+        measure(results, "accessor", get_name.c_str(), [&](std::size_t) {
+            consume(static_cast<std::size_t>(property.get_copy(object)));
+        });
+
+        const reflect::member_handle<bench_accessor_object, int> handle(property);
+        measure(results, "accessor", handle_get_name.c_str(), [&](std::size_t) {
+            consume(static_cast<std::size_t>(handle.get(object)));
+        });
+
+        if (property.has_setter() || property.has_member())
+        {
+            measure(results, "accessor", set_name.c_str(), [&](std::size_t i) {
+                property.set(object, static_cast<int>(i));
+                consume(static_cast<std::size_t>(property.get_copy(object)));
+            });
+
+            measure(results, "accessor", handle_set_name.c_str(), [&](std::size_t i) {
+                handle.set(object, static_cast<int>(i));
+                consume(static_cast<std::size_t>(handle.get(object)));
+            });
+        }
+    }
+
+    /**********************************************************/
+    void bench_accessors(std::vector<result>& results)
+    {
+        using reflect::property;
+        using object_type = bench_accessor_object;
+
+        bench_property(results, "member", property("member", &object_type::member));
+        bench_property(results, "readonly_ref", property("value", &object_type::get_value_ref));
+        bench_property(results, "readonly_val", property("value", &object_type::get_value));
+        bench_property(results, "ref_ref", property("value", &object_type::get_value_ref, &object_type::set_value_ref));
+        bench_property(results, "val_val", property("value", &object_type::get_value, &object_type::set_value));
+        bench_property(results, "val_ref", property("value", &object_type::get_value, &object_type::set_value_ref));
+        bench_property(results, "ref_rval", property("value", &object_type::get_value_ref, &object_type::set_value_rval));
+        bench_property(results, "dynamic_member", reflect::property_impl<object_type, int>("member", &object_type::member));
+        bench_property(results, "dynamic_val_val", reflect::property_impl<object_type, int>("value", &object_type::get_value, &object_type::set_value));
+
+        object_type object;
+        measure(results, "accessor", "baseline_get", [&](std::size_t) {
+            consume(static_cast<std::size_t>(object.get_value()));
+        });
+
+        measure(results, "accessor", "baseline_set", [&](std::size_t i) {
+            object.set_value(static_cast<int>(i));
+            consume(static_cast<std::size_t>(object.get_value()));
+        });
+    }
+
+} // namespace
+
+/**********************************************************/
+int main(int argc, char** argv)
+{
+    // The results are written to the supplied file, or to the standard output if none is given. The file is
+    // opened first, so that a path which cannot be written is reported before the benchmarks are run.
+    std::ofstream file;
+    if (argc > 1)
+    {
+        file.open(argv[1]);
+        if (!file.is_open())
+        {
+            std::cerr << "Cannot open " << argv[1] << " to write the results." << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<result> results;
+
+    bench_class<bench_object_4>(results, "class_4", g_names_4, [](const bench_object_4& object) {
+        std::size_t sum = 0;
+        BENCH_FIELDS_4(BENCH_SUM, BENCH_NONE, f)
+        return sum;
+    });
+
+    bench_class<bench_object_32>(results, "class_32", g_names_32, [](const bench_object_32& object) {
+        std::size_t sum = 0;
+        BENCH_FIELDS_32(BENCH_SUM, BENCH_NONE, f)
+        return sum;
+    });
+
+    bench_class<bench_object_256>(results, "class_256", g_names_256, [](const bench_object_256& object) {
+        std::size_t sum = 0;
+        BENCH_FIELDS_256(BENCH_SUM, BENCH_NONE, f)
+        return sum;
+    });
+
+    bench_enum(results);
+    bench_paths(results);
+    bench_batches(results);
+    bench_registry(results);
+    bench_accessors(results);
+
+    if (!file.is_open())
+    {
+        write_json(std::cout, results);
+        return 0;
+    }
+
+    write_json(file, results);
+    if (!file)
+    {
+        std::cerr << "Cannot write the results to " << argv[1] << "." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _BENCH_OBJECTS_HPP_
+#define _BENCH_OBJECTS_HPP_
+
+#include <string>
+
+//====================
+// Field generation
+//====================
+// Each field list invokes X with the name of every field, and S() between consecutive fields.
+#define BENCH_FIELDS_4(X, S, p)   X(p##0) S() X(p##1) S() X(p##2) S() X(p##3)
+#define BENCH_FIELDS_32(X, S, p)  BENCH_FIELDS_4(X, S, p##0) S() BENCH_FIELDS_4(X, S, p##1) S() \
+                                  BENCH_FIELDS_4(X, S, p##2) S() BENCH_FIELDS_4(X, S, p##3) S() \
+                                  BENCH_FIELDS_4(X, S, p##4) S() BENCH_FIELDS_4(X, S, p##5) S() \
+                                  BENCH_FIELDS_4(X, S, p##6) S() BENCH_FIELDS_4(X, S, p##7)
+#define BENCH_FIELDS_256(X, S, p) BENCH_FIELDS_32(X, S, p##0) S() BENCH_FIELDS_32(X, S, p##1) S() \
+                                  BENCH_FIELDS_32(X, S, p##2) S() BENCH_FIELDS_32(X, S, p##3) S() \
+                                  BENCH_FIELDS_32(X, S, p##4) S() BENCH_FIELDS_32(X, S, p##5) S() \
+                                  BENCH_FIELDS_32(X, S, p##6) S() BENCH_FIELDS_32(X, S, p##7)
+
+// Separators placed between the fields.
+#define BENCH_NONE()
+#define BENCH_COMMA() ,
+
+// Operations applied to each field.
+#define BENCH_DECLARE(name) int name = 0;
+#define BENCH_NAME(name)    #name
+#define BENCH_SUM(name)     sum += object.name;
+
+#define BENCH_PROPERTY_4(name)   property(#name, &bench_object_4::name)
+#define BENCH_PROPERTY_32(name)  property(#name, &bench_object_32::name)
+#define BENCH_PROPERTY_256(name) property(#name, &bench_object_256::name)
+
+//====================
+// Objects
+//====================
+struct bench_object_4
+{
+    BENCH_FIELDS_4(BENCH_DECLARE, BENCH_NONE, f)
+};
+
+struct bench_object_32
+{
+    BENCH_FIELDS_32(BENCH_DECLARE, BENCH_NONE, f)
+};
+
+struct bench_object_256
+{
+    BENCH_FIELDS_256(BENCH_DECLARE, BENCH_NONE, f)
+};
+
+class bench_nested_object final
+{
+private:
+    bench_object_4 m_inner;
+
+public:
+    bench_object_4 outer;
+
+    const bench_object_4& get_inner() const { return m_inner; }
+    void set_inner(const bench_object_4& inner) { m_inner = inner; }
+};
+
+enum class bench_colour
+{
+    RED,
+    GREEN,
+    BLUE,
+    CYAN,
+    MAGENTA,
+    YELLOW,
+    BLACK,
+    WHITE
+};
+
+class bench_enum_object final
+{
+private:
+    bench_colour m_colour = bench_colour::RED;
+
+public:
+    bench_colour get_colour() const { return m_colour; }
+    void set_colour(const bench_colour& colour) { m_colour = colour; }
+};
+
+class bench_accessor_object final
+{
+private:
+    int m_value = 0;
+
+public:
+    int member = 0;
+
+    int get_value() const { return m_value; }
+    const int& get_value_ref() const { return m_value; }
+    void set_value(int value) { m_value = value; }
+    void set_value_ref(const int& value) { m_value = value; }
+    void set_value_rval(int&& value) { m_value = value; }
+};
+
+/**********************************************************/
+#include <reflect/reflect.hpp>
+
+namespace reflect
+{
+    template <>
+    constexpr auto register_class<bench_object_4>()
+    {
+        return properties(BENCH_FIELDS_4(BENCH_PROPERTY_4, BENCH_COMMA, f));
+    }
+
+    template <>
+    constexpr auto register_class<bench_object_32>()
+    {
+        return properties(BENCH_FIELDS_32(BENCH_PROPERTY_32, BENCH_COMMA, f));
+    }
+
+    template <>
+    constexpr auto register_class<bench_object_256>()
+    {
+        return properties(BENCH_FIELDS_256(BENCH_PROPERTY_256, BENCH_COMMA, f));
+    }
+
+    template <>
+    constexpr auto register_class<bench_nested_object>()
+    {
+        return properties(
+            property("outer", &bench_nested_object::outer),
+            property("inner", &bench_nested_object::get_inner, &bench_nested_object::set_inner)
+        );
+    }
+
+    template <>
+    constexpr auto register_class<bench_enum_object>()
+    {
+        return properties(
+            enum_property("colour", &bench_enum_object::get_colour, &bench_enum_object::set_colour)
+                .set_value("Red", bench_colour::RED)
+                .set_value("Green", bench_colour::GREEN)
+                .set_value("Blue", bench_colour::BLUE)
+                .set_value("Cyan", bench_colour::CYAN)
+                .set_value("Magenta", bench_colour::MAGENTA)
+                .set_value("Yellow", bench_colour::YELLOW)
+                .set_value("Black", bench_colour::BLACK)
+                .set_value("White", bench_colour::WHITE)
+        );
+    }
+
+    template <>
+    inline std::string register_name<bench_object_4>()
+    {
+        return "bench_object_4";
+    }
+
+    template <>
+    inline std::string register_name<bench_object_32>()
+    {
+        return "bench_object_32";
+    }
+
+    template <>
+    inline std::string register_name<bench_object_256>()
+    {
+        return "bench_object_256";
+    }
+}
+
+#endif//_BENCH_OBJECTS_HPP_
\ No newline at end of file
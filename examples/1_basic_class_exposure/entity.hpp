@@ -64,7 +64,7 @@ public:
 namespace reflect
 {
     template <>
-    inline auto register_class<position_t>()
+    constexpr auto register_class<position_t>()
     {
         return properties(
             // Directly registering the public member variables.
@@ -74,7 +74,7 @@ namespace reflect
     }
 
     template <>
-    inline auto register_class<entity>()
+    constexpr auto register_class<entity>()
     {
         return properties(
             // Setting through the getters and setters.
@@ -1,6 +1,86 @@
-#include "json/json.h"
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
 
-int main(int argc, char** argv)
+#include <iostream>
+#include <string>
+#include <vector>
+#include <reflect/reflect.hpp>
+#include <reflect/json_writer.hpp>
+
+struct vector3_t
+{
+    float x;
+    float y;
+    float z;
+};
+
+struct player_t
+{
+    std::string      name;
+    int              health;
+    vector3_t        position;
+    std::vector<int> inventory;
+};
+
+namespace reflect
 {
+    template <>
+    constexpr auto register_class<vector3_t>()
+    {
+        return properties(
+            property("x", &vector3_t::x),
+            property("y", &vector3_t::y),
+            property("z", &vector3_t::z)
+        );
+    }
+
+    template <>
+    constexpr auto register_class<player_t>()
+    {
+        return properties(
+            property("name", &player_t::name),
+            property("health", &player_t::health),
+            // Registered classes are written as nested objects.
+            property("position", &player_t::position),
+            property("inventory", &player_t::inventory)
+        );
+    }
+}
+
+int main()
+{
+    std::vector<player_t> players = {
+        { "alice", 100, { 1.0f, 2.0f, 3.0f }, { 4, 8 } },
+        { "bob", 75, { -1.5f, 0.0f, 10.0f }, {} }
+    };
+
+    // A single writer is reused, so its buffer is only allocated once.
+    reflect::json_writer writer;
+    for (const player_t& player : players)
+    {
+        writer.clear();
+        writer.write(player);
+        std::cout << writer.view() << std::endl;
+    }
+
     return 0;
 }
\ No newline at end of file
@@ -1,6 +0,0 @@
-#ifndef _SERIALIZATION_HPP_
-#define _SERIALIZATION_HPP_
-
-#include "json/json.h"
-
-#endif//_SERIALIZATION_HPP_
@@ -0,0 +1,112 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_ALGORITHMS_HPP_
+#define _REFLECT_ALGORITHMS_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <type_traits> // Selecting between the bitwise and per-property paths.
+#include <vector>      // Comparing arrays.
+
+//====================
+// Reflect includes
+//====================
+#include "meta_class.hpp"            // Iterating the registered properties.
+#include "detail/bitwise_layout.hpp" // Copying and comparing plain structs as bytes.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /** @brief Copies each settable property through its getter and setter. */
+        template <typename Class>
+        void copy_properties(const Class& source, Class& destination, std::false_type);
+
+        /** @brief Copies the byte ranges of the registered member variables of a bitwise class. */
+        template <typename Class>
+        void copy_properties(const Class& source, Class& destination, std::true_type);
+
+        /** @brief Compares each property through its getter, stopping at the first difference. */
+        template <typename Class>
+        bool equal_properties(const Class& lhs, const Class& rhs, std::false_type);
+
+        /** @brief Compares the byte ranges of the registered member variables of a bitwise comparable class. */
+        template <typename Class>
+        bool equal_properties(const Class& lhs, const Class& rhs, std::true_type);
+
+        /** @brief Compares values of a type that has not been registered with its equality operator. */
+        template <typename T, typename = std::enable_if_t<!is_registered<T>()>>
+        bool equal_values(const T& lhs, const T& rhs);
+
+        /** @brief Compares values of a registered class by their registered properties. */
+        template <typename T, typename = std::enable_if_t<is_registered<T>()>, typename = void>
+        bool equal_values(const T& lhs, const T& rhs);
+
+        /** @brief Compares vectors element by element, or as a single range of bytes if the elements are packed and bitwise comparable. */
+        template <typename T, typename = std::enable_if_t<!std::is_same<T, bool>::value>>
+        bool equal_values(const std::vector<T>& lhs, const std::vector<T>& rhs);
+
+    } // namespace detail
+
+    //====================
+    // Functions
+    //====================
+    /**
+     * @brief Copies the value of each registered property from one object to another.
+     *
+     * Read-only properties are not copied. If the class is trivially copyable and only registers member
+     * pointers to arithmetic types, enums or other such classes, the copy collapses to copying the byte
+     * ranges of the registered members instead of walking each property.
+     *
+     * @param source      The object to copy from.
+     * @param destination The object to copy to.
+     */
+    template <typename Class>
+    void copy_members(const Class& source, Class& destination);
+
+    /**
+     * @brief Checks whether the values of every registered property of two objects are equal.
+     *
+     * Nested registered classes are compared by their registered properties. Classes that can be copied
+     * as bytes, and contain no floating point members, are compared as byte ranges instead.
+     *
+     * @param lhs The first object to compare.
+     * @param rhs The second object to compare.
+     *
+     * @returns True if every registered property is equal.
+     */
+    template <typename Class>
+    bool members_equal(const Class& lhs, const Class& rhs);
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "algorithms.inl" // Method declarations.
+
+#endif//_REFLECT_ALGORITHMS_HPP_
\ No newline at end of file
@@ -0,0 +1,139 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+//====================
+// C++ includes
+//====================
+#include <cstring> // Comparing packed arrays.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**********************************************************/
+        template <typename Class>
+        void copy_properties(const Class& source, Class& destination, std::false_type)
+        {
+            for_tuple([&source, &destination](const auto& member) {
+                if (member.has_setter() || member.has_member())
+                {
+                    member.set(destination, member.get_copy(source));
+                }
+            }, get_members<Class>());
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        void copy_properties(const Class& source, Class& destination, std::true_type)
+        {
+            copy_bitwise(source, destination);
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        bool equal_properties(const Class& lhs, const Class& rhs, std::false_type)
+        {
+            bool equal = true;
+            for_tuple([&lhs, &rhs, &equal](const auto& member) {
+                if (equal)
+                {
+                    equal = member.visit(lhs, [&member, &rhs](const auto& left) {
+                        return member.visit(rhs, [&left](const auto& right) {
+                            return equal_values(left, right);
+                        });
+                    });
+                }
+            }, get_members<Class>());
+
+            return equal;
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        bool equal_properties(const Class& lhs, const Class& rhs, std::true_type)
+        {
+            return equal_bitwise(lhs, rhs);
+        }
+
+        /**********************************************************/
+        template <typename T, typename>
+        bool equal_values(const T& lhs, const T& rhs)
+        {
+            return lhs == rhs;
+        }
+
+        /**********************************************************/
+        template <typename T, typename, typename>
+        bool equal_values(const T& lhs, const T& rhs)
+        {
+            return members_equal(lhs, rhs);
+        }
+
+        /**********************************************************/
+        template <typename T, typename>
+        bool equal_values(const std::vector<T>& lhs, const std::vector<T>& rhs)
+        {
+            if (lhs.size() != rhs.size())
+            {
+                return false;
+            }
+            else if (bitwise_traits<T>::comparable && is_bitwise_packed<T>())
+            {
+                return lhs.empty() || std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0;
+            }
+
+            for (std::size_t i = 0; i < lhs.size(); ++i)
+            {
+                if (!equal_values(lhs[i], rhs[i]))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    } // namespace detail
+
+    //====================
+    // Functions
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    void copy_members(const Class& source, Class& destination)
+    {
+        static_assert(is_registered<Class>(), "Only registered classes can have their members copied.");
+        detail::copy_properties(source, destination, std::integral_constant<bool, detail::bitwise_traits<Class>::copyable>());
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    bool members_equal(const Class& lhs, const Class& rhs)
+    {
+        static_assert(is_registered<Class>(), "Only registered classes can have their members compared.");
+        return detail::equal_properties(lhs, rhs, std::integral_constant<bool, detail::bitwise_traits<Class>::comparable>());
+    }
+
+} // namespace reflect
\ No newline at end of file
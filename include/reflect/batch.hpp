@@ -0,0 +1,127 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_BATCH_HPP_
+#define _REFLECT_BATCH_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef>     // Counting the objects of a batch.
+#include <type_traits> // Selecting between member pointer and accessor loops.
+
+//====================
+// Reflect includes
+//====================
+#include "meta_class.hpp"            // Resolving the member variables of a batch.
+#include "span.hpp"                  // Viewing the objects and values of a batch.
+#include "string_view.hpp"           // Naming the member variable of a batch.
+#include "detail/meta_exception.hpp" // Reporting unknown member variables.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Structs
+        //====================
+        /** Checks whether the property is bound directly to a member variable, which paths and accessors are not. */
+        template <typename Property, typename = void>
+        struct has_member_pointer : std::false_type {};
+
+        /** Checks whether the property is bound directly to a member variable, which paths and accessors are not. */
+        template <typename Property>
+        struct has_member_pointer<Property, std::enable_if_t<is_member_accessor<typename Property::accessor_type>::value>> : std::true_type {};
+
+        //====================
+        // Functions
+        //====================
+        /** @brief Copies the member variable of each object into the output through its member pointer, as a strided load. */
+        template <typename Property, typename Class, typename T>
+        void gather_property(const Property& member, const Class* objects, std::size_t count, T* output, std::true_type);
+
+        /** @brief Copies the member variable of each object into the output through the getter of the property. */
+        template <typename Property, typename Class, typename T>
+        void gather_property(const Property& member, const Class* objects, std::size_t count, T* output, std::false_type);
+
+        /** @brief Writes each value into the member variable of its object through the member pointer, as a strided store. */
+        template <typename Property, typename Class, typename T>
+        void scatter_property(const Property& member, Class* objects, std::size_t count, const T* values, std::true_type);
+
+        /** @brief Writes each value into the member variable of its object through the setter of the property. */
+        template <typename Property, typename Class, typename T>
+        void scatter_property(const Property& member, Class* objects, std::size_t count, const T* values, std::false_type);
+
+        /** @brief Throws an exception stating that the batched member variable has not been registered. */
+        [[noreturn]] void throw_unknown_member(string_view name);
+
+    } // namespace detail
+
+    //====================
+    // Functions
+    //====================
+    /**
+     * @brief Copies one member variable of each object into a contiguous buffer.
+     *
+     * The name, which may be a dotted path, is resolved once for the whole batch rather than for
+     * each object. Properties bound directly to a member variable are copied in a single loop over
+     * the member pointer, which the compiler is able to vectorize; other properties are read
+     * through their getters.
+     *
+     * @throws meta_exception If the member variable is not registered, does not match the supplied
+     *                        datatype, or the output holds fewer values than there are objects.
+     *
+     * @tparam T       The data-type of the member variable.
+     * @param objects  The objects to read the member variable of.
+     * @param name     The name of the member variable.
+     * @param output   The buffer to write the values to, in the order of the objects.
+     */
+    template <typename T, typename Class>
+    void gather(span<Class> objects, string_view name, span<T> output);
+
+    /**
+     * @brief Writes a contiguous buffer of values into one member variable of each object.
+     *
+     * The counterpart to gather(); the name, which may be a dotted path, is resolved once for the
+     * whole batch. Properties bound directly to a member variable are written in a single loop over
+     * the member pointer, which the compiler is able to vectorize; other properties are written
+     * through their setters.
+     *
+     * @throws meta_exception If the member variable is not registered, does not match the supplied
+     *                        datatype, is read-only, or there are fewer values than objects.
+     *
+     * @tparam T       The data-type of the member variable.
+     * @param objects  The objects to write the member variable of.
+     * @param name     The name of the member variable.
+     * @param values   The values to write, in the order of the objects.
+     */
+    template <typename T, typename Class>
+    void scatter(span<Class> objects, string_view name, span<const T> values);
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "batch.inl" // Method declarations.
+
+#endif//_REFLECT_BATCH_HPP_
\ No newline at end of file
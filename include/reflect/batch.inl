@@ -0,0 +1,137 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**********************************************************/
+        template <typename Property, typename Class, typename T>
+        void gather_property(const Property& member, const Class* objects, std::size_t count, T* output, std::true_type)
+        {
+            const member_ptr<Class, T> pointer = member.get_member();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                output[i] = objects[i].*pointer;
+            }
+        }
+
+        /**********************************************************/
+        template <typename Property, typename Class, typename T>
+        void gather_property(const Property& member, const Class* objects, std::size_t count, T* output, std::false_type)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                output[i] = member.get_copy(objects[i]);
+            }
+        }
+
+        /**********************************************************/
+        template <typename Property, typename Class, typename T>
+        void scatter_property(const Property& member, Class* objects, std::size_t count, const T* values, std::true_type)
+        {
+            const member_ptr<Class, T> pointer = member.get_member();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                objects[i].*pointer = values[i];
+            }
+        }
+
+        /**********************************************************/
+        template <typename Property, typename Class, typename T>
+        void scatter_property(const Property& member, Class* objects, std::size_t count, const T* values, std::false_type)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                member.set(objects[i], values[i]);
+            }
+        }
+
+        /**********************************************************/
+        inline void throw_unknown_member(string_view name)
+        {
+            std::string err = std::string("Member variable: ") + name.to_string() + std::string(" is not registered.");
+            throw meta_exception(err);
+        }
+
+    } // namespace detail
+
+    //====================
+    // Functions
+    //====================
+    /**********************************************************/
+    template <typename T, typename Class>
+    void gather(span<Class> objects, string_view name, span<T> output)
+    {
+        using class_type = std::remove_const_t<Class>;
+        static_assert(is_registered<class_type>(), "Only registered classes can have their members gathered.");
+
+        if (output.size() < objects.size())
+        {
+            throw detail::meta_exception("Cannot gather member variable: the output is smaller than the batch.");
+        }
+
+        bool found = false;
+        meta_class<class_type>::template for_path<T>(name, [&objects, &output, &found](const auto& member) {
+            found = true;
+            detail::gather_property(member, objects.data(), objects.size(), output.data(), detail::has_member_pointer<std::decay_t<decltype(member)>>());
+        });
+
+        if (!found)
+        {
+            detail::throw_unknown_member(name);
+        }
+    }
+
+    /**********************************************************/
+    template <typename T, typename Class>
+    void scatter(span<Class> objects, string_view name, span<const T> values)
+    {
+        static_assert(!std::is_const<Class>::value, "Members cannot be scattered into constant objects.");
+        static_assert(is_registered<Class>(), "Only registered classes can have their members scattered.");
+
+        if (values.size() < objects.size())
+        {
+            throw detail::meta_exception("Cannot scatter member variable: there are fewer values than objects in the batch.");
+        }
+
+        bool found = false;
+        meta_class<Class>::template for_path<T>(name, [&objects, &values, &found](const auto& member) {
+            found = true;
+            if (!member.has_setter() && !member.has_member())
+            {
+                throw detail::meta_exception("Cannot set value: no setters or member pointer set.");
+            }
+
+            detail::scatter_property(member, objects.data(), objects.size(), values.data(), detail::has_member_pointer<std::decay_t<decltype(member)>>());
+        });
+
+        if (!found)
+        {
+            detail::throw_unknown_member(name);
+        }
+    }
+
+} // namespace reflect
\ No newline at end of file
@@ -0,0 +1,467 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_BINARY_ARCHIVE_HPP_
+#define _REFLECT_BINARY_ARCHIVE_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef>     // Sizes of the archived values.
+#include <cstdint>     // Fixed-width fingerprints and length prefixes.
+#include <string>      // Archiving strings.
+#include <tuple>       // Inspecting the registered properties.
+#include <type_traits> // Selecting how each value is archived.
+#include <vector>      // Output buffer and archiving arrays.
+
+//====================
+// Reflect includes
+//====================
+#include "string_view.hpp"           // Hashing names into fingerprints.
+#include "meta_class.hpp"            // Iterating the registered properties.
+#include "detail/bitwise_layout.hpp" // Archiving plain structs as bytes.
+#include "detail/meta_exception.hpp" // Throwing on malformed archives.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Structs
+        //====================
+        /** Empty type used to select how the schema of a type is hashed. */
+        template <typename T>
+        struct schema_tag
+        {
+        };
+
+        /**
+         * Checks whether values of a type can be written to and read from a binary archive.
+         *
+         * Arithmetic types, enums, strings, vectors of supported types and registered classes whose
+         * properties are all supported can be archived.
+         */
+        template <typename T, typename = void>
+        struct is_archivable : std::integral_constant<bool, std::is_arithmetic<T>::value || std::is_enum<T>::value> {};
+
+        /** Strings are archived as their length followed by their characters. */
+        template <>
+        struct is_archivable<std::string> : std::true_type {};
+
+        /** Vectors are archived as their length followed by their elements. */
+        template <typename T>
+        struct is_archivable<std::vector<T>> : is_archivable<T> {};
+
+        /** Checks the registered properties of a class, which must all be archivable. */
+        template <typename Class, typename Properties>
+        struct archivable_members;
+
+        /** Checks the registered properties of a class, which must all be archivable. */
+        template <typename Class, typename... Properties>
+        struct archivable_members<Class, std::tuple<Properties...>>
+            : std::integral_constant<bool, all_of<is_archivable<std::decay_t<typename Properties::member_type>>::value...>::value> {};
+
+        /** Registered classes are archived as their registered properties. */
+        template <typename T>
+        struct is_archivable<T, std::enable_if_t<is_registered<T>()>> : archivable_members<T, std::decay_t<decltype(register_class<T>())>> {};
+
+        //====================
+        // Functions
+        //====================
+        /**
+         * @brief Combines the characters into a 64-bit FNV-1a hash.
+         *
+         * @param hash The hash to combine the characters with.
+         * @param text The characters to hash.
+         *
+         * @returns The combined hash.
+         */
+        constexpr std::uint64_t hash_schema(std::uint64_t hash, string_view text);
+
+        /** @brief Combines the schema of a boolean into the hash. */
+        std::uint64_t hash_schema(std::uint64_t hash, schema_tag<bool>);
+
+        /** @brief Combines the signedness and width of an integer into the hash. */
+        template <typename T, typename = std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>>
+        std::uint64_t hash_schema(std::uint64_t hash, schema_tag<T>);
+
+        /** @brief Combines the width of a floating point number into the hash. */
+        template <typename T, typename = std::enable_if_t<std::is_floating_point<T>::value>, typename = void>
+        std::uint64_t hash_schema(std::uint64_t hash, schema_tag<T>);
+
+        /** @brief Combines the underlying integer of an enum into the hash. */
+        template <typename T, typename = std::enable_if_t<std::is_enum<T>::value>, typename = void, typename = void>
+        std::uint64_t hash_schema(std::uint64_t hash, schema_tag<T>);
+
+        /** @brief Combines the schema of a string into the hash. */
+        std::uint64_t hash_schema(std::uint64_t hash, schema_tag<std::string>);
+
+        /** @brief Combines the schema of a vector and its elements into the hash. */
+        template <typename T>
+        std::uint64_t hash_schema(std::uint64_t hash, schema_tag<std::vector<T>>);
+
+        /** @brief Combines the name and schema of each registered property of a class into the hash. */
+        template <typename T, typename = std::enable_if_t<is_registered<T>()>, typename = void, typename = void, typename = void>
+        std::uint64_t hash_schema(std::uint64_t hash, schema_tag<T>);
+
+        /**
+         * @brief Writes an unsigned integer to the output, least significant byte first.
+         *
+         * @param out   The bytes to write to, which must have room for the integer.
+         * @param value The integer to write.
+         */
+        template <typename T>
+        void store_little_endian(char* out, T value);
+
+        /**
+         * @brief Reads an unsigned integer from the input, least significant byte first.
+         *
+         * @param in The bytes to read from, which must contain the integer.
+         *
+         * @returns The integer that was read.
+         */
+        template <typename T>
+        T load_little_endian(const char* in);
+
+    } // namespace detail
+
+    //====================
+    // Functions
+    //====================
+    /**
+     * @brief Retrieves the schema fingerprint of a registered class.
+     *
+     * The fingerprint is a hash of the name and type of each registered property, in registration order,
+     * descending into nested registered classes and vectors. It is computed once per class, and changes
+     * whenever a property is added, removed, renamed, reordered or changes type.
+     *
+     * @returns The fingerprint of the class.
+     */
+    template <typename Class>
+    std::uint64_t schema_fingerprint();
+
+    template <typename Class>
+    class patch;
+
+    class binary_writer final
+    {
+        // Patches encode the values of changed properties in the same format.
+        template <typename>
+        friend class patch;
+
+    private:
+        //====================
+        // Member variables
+        //====================
+        /** The buffer the archive is written to, which is only grown and never shrunk. */
+        std::vector<char> m_buffer;
+        /** The number of bytes that have been written to the buffer. */
+        std::size_t m_size;
+
+        //====================
+        // Private methods
+        //====================
+        /**
+         * @brief Ensures the buffer has room for the specified number of bytes after the written bytes.
+         *
+         * @param size The number of bytes that will be written.
+         *
+         * @returns A pointer to the end of the written bytes.
+         */
+        char* reserve(std::size_t size);
+
+        /**
+         * @brief Appends the bytes to the buffer.
+         *
+         * @param data The bytes to append.
+         * @param size The number of bytes to append.
+         */
+        void append(const char* data, std::size_t size);
+
+        /**
+         * @brief Appends the length prefix of a string or array.
+         *
+         * @param size The number of characters or elements.
+         *
+         * @throws meta_exception If the length does not fit within the 32-bit prefix.
+         */
+        void append_length(std::size_t size);
+
+        /** @brief Writes a boolean as a single byte. */
+        void write_value(bool value);
+
+        /** @brief Writes an integer in little-endian order, with its own width. */
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value> write_value(T value);
+
+        /** @brief Writes the bits of a 32 or 64-bit floating point number in little-endian order. */
+        template <typename T>
+        std::enable_if_t<std::is_floating_point<T>::value> write_value(T value);
+
+        /** @brief Writes an enum as its underlying integer. */
+        template <typename T>
+        std::enable_if_t<std::is_enum<T>::value> write_value(T value);
+
+        /** @brief Writes a string, prefixed by its length. */
+        void write_value(const std::string& value);
+
+        /** @brief Writes each element of the vector, prefixed by the number of elements. */
+        template <typename T>
+        void write_value(const std::vector<T>& values);
+
+        /** @brief Writes the value of each registered property of a class, in registration order. */
+        template <typename T>
+        std::enable_if_t<is_registered<T>()> write_value(const T& value);
+
+        /** @brief Writes the value of each registered property through its getter. */
+        template <typename T>
+        void write_members(const T& value, std::false_type);
+
+        /** @brief Writes the byte ranges of the registered member variables of a bitwise class, on little-endian hosts. */
+        template <typename T>
+        void write_members(const T& value, std::true_type);
+
+        /** @brief Writes each element of the vector in turn. */
+        template <typename T>
+        void write_elements(const std::vector<T>& values, std::false_type);
+
+        /** @brief Writes the elements of the vector as a single range of bytes if they are packed, on little-endian hosts. */
+        template <typename T>
+        void write_elements(const std::vector<T>& values, std::true_type);
+
+    public:
+        //====================
+        // Ctors and dtor
+        //====================
+        /**
+         * @brief Constructor for creating a writer with an empty buffer.
+         */
+        explicit binary_writer();
+
+        /**
+         * @brief Default destructor.
+         */
+        ~binary_writer() = default;
+
+        //====================
+        // Getters and setters
+        //====================
+        /**
+         * @brief Retrieves the bytes that have been written.
+         *
+         * The pointer is invalidated when more is written or the writer is cleared.
+         *
+         * @returns The contents of the buffer.
+         */
+        const char* data() const;
+
+        /**
+         * @brief Retrieves the number of bytes that have been written.
+         *
+         * @returns The size of the archive.
+         */
+        std::size_t size() const;
+
+        //====================
+        // Methods
+        //====================
+        /**
+         * @brief Appends a registered object to the buffer, preceded by the schema fingerprint of its class.
+         *
+         * The values of the registered properties are written in registration order without any names or
+         * tags. Arithmetic values are written little-endian with their own width, enums as their underlying
+         * integer, strings and vectors are prefixed by a 32-bit length, and nested registered classes are
+         * written in place. Plain structs that only register member pointers to such values are written as
+         * the byte ranges of their members, and packed arrays of them as a single range.
+         *
+         * @param object The object to write.
+         */
+        template <typename Class>
+        void write(const Class& object);
+
+        /**
+         * @brief Empties the buffer, keeping its capacity so it can be reused for the next object.
+         */
+        void clear();
+    };
+
+    class binary_reader final
+    {
+        // Patches decode the values of changed properties in the same format.
+        template <typename>
+        friend class patch;
+
+    private:
+        //====================
+        // Member variables
+        //====================
+        /** The first byte of the archive, which is viewed rather than copied. */
+        const char* m_data;
+        /** The number of bytes within the archive. */
+        std::size_t m_size;
+        /** The position of the next byte to read. */
+        std::size_t m_position;
+
+        //====================
+        // Private methods
+        //====================
+        /**
+         * @brief Consumes the specified number of bytes.
+         *
+         * @param size The number of bytes to consume.
+         *
+         * @returns A pointer to the first consumed byte.
+         *
+         * @throws meta_exception If the archive ends before the bytes.
+         */
+        const char* consume(std::size_t size);
+
+        /** @brief Reads a boolean from a single byte. */
+        void read_value(bool& value);
+
+        /** @brief Reads a little-endian integer with its own width. */
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value> read_value(T& value);
+
+        /** @brief Reads the little-endian bits of a 32 or 64-bit floating point number. */
+        template <typename T>
+        std::enable_if_t<std::is_floating_point<T>::value> read_value(T& value);
+
+        /** @brief Reads an enum from its underlying integer. */
+        template <typename T>
+        std::enable_if_t<std::is_enum<T>::value> read_value(T& value);
+
+        /** @brief Reads a length-prefixed string. */
+        void read_value(std::string& value);
+
+        /** @brief Reads a length-prefixed array, replacing the elements of the vector. */
+        template <typename T>
+        void read_value(std::vector<T>& values);
+
+        /** @brief Reads the value of each registered property of a class, skipping those which are read-only. */
+        template <typename T>
+        std::enable_if_t<is_registered<T>()> read_value(T& value);
+
+        /** @brief Reads the value of each registered property through its setter. */
+        template <typename T>
+        void read_members(T& value, std::false_type);
+
+        /** @brief Reads the byte ranges of the registered member variables of a bitwise class, on little-endian hosts. */
+        template <typename T>
+        void read_members(T& value, std::true_type);
+
+        /** @brief Reads each element of the vector in turn. */
+        template <typename T>
+        void read_elements(std::vector<T>& values, std::uint32_t size, std::false_type);
+
+        /** @brief Reads the elements of the vector as a single range of bytes if they are packed, on little-endian hosts. */
+        template <typename T>
+        void read_elements(std::vector<T>& values, std::uint32_t size, std::true_type);
+
+    public:
+        //====================
+        // Ctors and dtor
+        //====================
+        /**
+         * @brief Constructor for reading from the specified archive.
+         *
+         * @param data The first byte of the archive, which must outlive the reader.
+         * @param size The number of bytes within the archive.
+         */
+        explicit binary_reader(const char* data, std::size_t size);
+
+        /**
+         * @brief Default destructor.
+         */
+        ~binary_reader() = default;
+
+        //====================
+        // Getters and setters
+        //====================
+        /**
+         * @brief Checks whether the whole archive has been read.
+         *
+         * @returns True if there is nothing left to read.
+         */
+        bool at_end() const;
+
+        /**
+         * @brief Retrieves the schema fingerprint of the next object within the archive, without consuming it.
+         *
+         * This can be compared against schema_fingerprint() to decide how an archive should be read.
+         *
+         * @returns The fingerprint the next object was written with.
+         *
+         * @throws meta_exception If the archive ends before the fingerprint.
+         */
+        std::uint64_t fingerprint() const;
+
+        //====================
+        // Methods
+        //====================
+        /**
+         * @brief Reads the next object within the archive into a registered object.
+         *
+         * The fingerprint of the object is checked once against the class. As the schemas then match, the
+         * values are read positionally straight into the properties without looking up names or checking
+         * types; only the bounds of the archive are checked.
+         *
+         * @param object The object to read into.
+         *
+         * @throws meta_exception If the fingerprint does not match the class or the archive is truncated.
+         */
+        template <typename Class>
+        void read(Class& object);
+    };
+
+    //====================
+    // Functions
+    //====================
+    /**
+     * @brief Serializes a registered object to a binary archive.
+     *
+     * @param object The object to serialize.
+     *
+     * @returns The bytes of the archive.
+     */
+    template <typename Class>
+    std::vector<char> to_binary(const Class& object);
+
+    /**
+     * @brief Deserializes a binary archive into a registered object.
+     *
+     * @param archive The bytes of the archive, which must contain a single object.
+     * @param object  The object to read into.
+     *
+     * @throws meta_exception If the fingerprint does not match, or the archive is truncated or contains anything after the object.
+     */
+    template <typename Class>
+    void from_binary(const std::vector<char>& archive, Class& object);
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "binary_archive.inl" // Method declarations.
+
+#endif//_REFLECT_BINARY_ARCHIVE_HPP_
\ No newline at end of file
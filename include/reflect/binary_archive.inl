@@ -0,0 +1,548 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+//====================
+// C++ includes
+//====================
+#include <cstring> // Copying bytes into the buffer and the bits of floating point numbers.
+#include <limits>  // Checking the length of strings and arrays.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**********************************************************/
+        constexpr std::uint64_t hash_schema(std::uint64_t hash, string_view text)
+        {
+            for (std::size_t i = 0; i < text.size(); ++i)
+            {
+                hash ^= static_cast<unsigned char>(text[i]);
+                hash *= 1099511628211ull;
+            }
+
+            return hash;
+        }
+
+        /**********************************************************/
+        inline std::uint64_t hash_schema(std::uint64_t hash, schema_tag<bool>)
+        {
+            return hash_schema(hash, "bool");
+        }
+
+        /**********************************************************/
+        template <typename T, typename>
+        std::uint64_t hash_schema(std::uint64_t hash, schema_tag<T>)
+        {
+            const char code[] = { std::is_signed<T>::value ? 'i' : 'u', static_cast<char>('0' + sizeof(T)) };
+            return hash_schema(hash, string_view(code, sizeof(code)));
+        }
+
+        /**********************************************************/
+        template <typename T, typename, typename>
+        std::uint64_t hash_schema(std::uint64_t hash, schema_tag<T>)
+        {
+            const char code[] = { 'f', static_cast<char>('0' + sizeof(T)) };
+            return hash_schema(hash, string_view(code, sizeof(code)));
+        }
+
+        /**********************************************************/
+        template <typename T, typename, typename, typename>
+        std::uint64_t hash_schema(std::uint64_t hash, schema_tag<T>)
+        {
+            return hash_schema(hash_schema(hash, "enum "), schema_tag<std::underlying_type_t<T>>());
+        }
+
+        /**********************************************************/
+        inline std::uint64_t hash_schema(std::uint64_t hash, schema_tag<std::string>)
+        {
+            return hash_schema(hash, "string");
+        }
+
+        /**********************************************************/
+        template <typename T>
+        std::uint64_t hash_schema(std::uint64_t hash, schema_tag<std::vector<T>>)
+        {
+            return hash_schema(hash_schema(hash_schema(hash, "vector<"), schema_tag<T>()), ">");
+        }
+
+        /**********************************************************/
+        template <typename T, typename, typename, typename, typename>
+        std::uint64_t hash_schema(std::uint64_t hash, schema_tag<T>)
+        {
+            hash = hash_schema(hash, "{");
+            for_tuple([&hash](const auto& member) {
+                using member_type = typename std::decay_t<decltype(member)>::member_type;
+
+                hash = hash_schema(hash_schema(hash, member.get_name()), ":");
+                hash = hash_schema(hash_schema(hash, schema_tag<member_type>()), ";");
+            }, get_members<T>());
+
+            return hash_schema(hash, "}");
+        }
+
+        /**********************************************************/
+        template <typename T>
+        void store_little_endian(char* out, T value)
+        {
+            static_assert(std::is_unsigned<T>::value, "Only unsigned integers can be stored.");
+
+            for (std::size_t i = 0; i < sizeof(T); ++i)
+            {
+                out[i] = static_cast<char>(static_cast<unsigned char>(value >> (i * 8)));
+            }
+        }
+
+        /**********************************************************/
+        template <typename T>
+        T load_little_endian(const char* in)
+        {
+            static_assert(std::is_unsigned<T>::value, "Only unsigned integers can be loaded.");
+
+            T value = 0;
+            for (std::size_t i = 0; i < sizeof(T); ++i)
+            {
+                value |= static_cast<T>(static_cast<T>(static_cast<unsigned char>(in[i])) << (i * 8));
+            }
+
+            return value;
+        }
+
+    } // namespace detail
+
+    //====================
+    // Functions
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    std::uint64_t schema_fingerprint()
+    {
+        static_assert(is_registered<Class>(), "Only registered classes have a schema fingerprint.");
+
+        static const std::uint64_t fingerprint = detail::hash_schema(14695981039346656037ull, detail::schema_tag<Class>());
+        return fingerprint;
+    }
+
+    //====================
+    // Ctors and dtor
+    //====================
+    /**********************************************************/
+    inline binary_writer::binary_writer()
+        : m_buffer(), m_size(0)
+    {
+        // Empty.
+    }
+
+    //====================
+    // Private methods
+    //====================
+    /**********************************************************/
+    inline char* binary_writer::reserve(std::size_t size)
+    {
+        if (m_size + size > m_buffer.size())
+        {
+            const std::size_t doubled = m_buffer.size() * 2;
+            m_buffer.resize(doubled > m_size + size ? doubled : m_size + size);
+        }
+
+        return m_buffer.data() + m_size;
+    }
+
+    /**********************************************************/
+    inline void binary_writer::append(const char* data, std::size_t size)
+    {
+        if (size != 0)
+        {
+            std::memcpy(this->reserve(size), data, size);
+            m_size += size;
+        }
+    }
+
+    /**********************************************************/
+    inline void binary_writer::append_length(std::size_t size)
+    {
+        if (size > std::numeric_limits<std::uint32_t>::max())
+        {
+            throw detail::meta_exception("Strings and arrays with more than 2^32 - 1 elements cannot be archived.");
+        }
+
+        detail::store_little_endian(this->reserve(sizeof(std::uint32_t)), static_cast<std::uint32_t>(size));
+        m_size += sizeof(std::uint32_t);
+    }
+
+    /**********************************************************/
+    inline void binary_writer::write_value(bool value)
+    {
+        *this->reserve(1) = value ? 1 : 0;
+        ++m_size;
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value> binary_writer::write_value(T value)
+    {
+        detail::store_little_endian(this->reserve(sizeof(T)), static_cast<std::make_unsigned_t<T>>(value));
+        m_size += sizeof(T);
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<std::is_floating_point<T>::value> binary_writer::write_value(T value)
+    {
+        static_assert(sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t), "Only 32 and 64-bit floating point numbers can be archived.");
+
+        std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t> bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        this->write_value(bits);
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<std::is_enum<T>::value> binary_writer::write_value(T value)
+    {
+        this->write_value(static_cast<std::underlying_type_t<T>>(value));
+    }
+
+    /**********************************************************/
+    inline void binary_writer::write_value(const std::string& value)
+    {
+        this->append_length(value.size());
+        this->append(value.data(), value.size());
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void binary_writer::write_value(const std::vector<T>& values)
+    {
+        this->append_length(values.size());
+        this->write_elements(values, std::integral_constant<bool, detail::bitwise_traits<T>::copyable>());
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<is_registered<T>()> binary_writer::write_value(const T& value)
+    {
+        this->write_members(value, std::integral_constant<bool, detail::bitwise_traits<T>::copyable>());
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void binary_writer::write_members(const T& value, std::false_type)
+    {
+        detail::for_tuple([this, &value](const auto& member) {
+            member.visit(value, [this](const auto& v) {
+                this->write_value(v);
+            });
+        }, get_members<T>());
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void binary_writer::write_members(const T& value, std::true_type)
+    {
+        if (!detail::is_little_endian())
+        {
+            this->write_members(value, std::false_type());
+            return;
+        }
+
+        const char* const data = reinterpret_cast<const char*>(&value);
+        for (const detail::byte_range& range : detail::bitwise_ranges<T>())
+        {
+            this->append(data + range.offset, range.size);
+        }
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void binary_writer::write_elements(const std::vector<T>& values, std::false_type)
+    {
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            this->write_value(values[i]);
+        }
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void binary_writer::write_elements(const std::vector<T>& values, std::true_type)
+    {
+        if (!detail::is_little_endian() || !detail::is_bitwise_packed<T>())
+        {
+            this->write_elements(values, std::false_type());
+            return;
+        }
+
+        this->append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    //====================
+    // Getters and setters
+    //====================
+    /**********************************************************/
+    inline const char* binary_writer::data() const
+    {
+        return m_buffer.data();
+    }
+
+    /**********************************************************/
+    inline std::size_t binary_writer::size() const
+    {
+        return m_size;
+    }
+
+    //====================
+    // Methods
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    void binary_writer::write(const Class& object)
+    {
+        static_assert(is_registered<Class>(), "Only registered classes can be archived.");
+
+        this->write_value(schema_fingerprint<Class>());
+        this->write_value(object);
+    }
+
+    /**********************************************************/
+    inline void binary_writer::clear()
+    {
+        m_size = 0;
+    }
+
+    //====================
+    // Ctors and dtor
+    //====================
+    /**********************************************************/
+    inline binary_reader::binary_reader(const char* data, std::size_t size)
+        : m_data(data), m_size(size), m_position(0)
+    {
+        // Empty.
+    }
+
+    //====================
+    // Private methods
+    //====================
+    /**********************************************************/
+    inline const char* binary_reader::consume(std::size_t size)
+    {
+        if (m_size - m_position < size)
+        {
+            throw detail::meta_exception("The binary archive is truncated.");
+        }
+
+        const char* const data = m_data + m_position;
+        m_position += size;
+        return data;
+    }
+
+    /**********************************************************/
+    inline void binary_reader::read_value(bool& value)
+    {
+        value = *this->consume(1) != 0;
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value> binary_reader::read_value(T& value)
+    {
+        value = static_cast<T>(detail::load_little_endian<std::make_unsigned_t<T>>(this->consume(sizeof(T))));
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<std::is_floating_point<T>::value> binary_reader::read_value(T& value)
+    {
+        static_assert(sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t), "Only 32 and 64-bit floating point numbers can be archived.");
+
+        std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t> bits;
+        this->read_value(bits);
+        std::memcpy(&value, &bits, sizeof(T));
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<std::is_enum<T>::value> binary_reader::read_value(T& value)
+    {
+        std::underlying_type_t<T> underlying;
+        this->read_value(underlying);
+        value = static_cast<T>(underlying);
+    }
+
+    /**********************************************************/
+    inline void binary_reader::read_value(std::string& value)
+    {
+        std::uint32_t size;
+        this->read_value(size);
+        value.assign(this->consume(size), size);
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void binary_reader::read_value(std::vector<T>& values)
+    {
+        std::uint32_t size;
+        this->read_value(size);
+        this->read_elements(values, size, std::integral_constant<bool, detail::bitwise_traits<T>::copyable>());
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<is_registered<T>()> binary_reader::read_value(T& value)
+    {
+        this->read_members(value, std::integral_constant<bool, detail::bitwise_traits<T>::copyable>());
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void binary_reader::read_members(T& value, std::false_type)
+    {
+        detail::for_tuple([this, &value](const auto& member) {
+            typename std::decay_t<decltype(member)>::member_type v = typename std::decay_t<decltype(member)>::member_type();
+            this->read_value(v);
+
+            // Values of read-only properties are still archived, so they are read and discarded.
+            if (member.has_setter() || member.has_member())
+            {
+                member.set(value, std::move(v));
+            }
+        }, get_members<T>());
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void binary_reader::read_members(T& value, std::true_type)
+    {
+        if (!detail::is_little_endian())
+        {
+            this->read_members(value, std::false_type());
+            return;
+        }
+
+        char* const data = reinterpret_cast<char*>(&value);
+        for (const detail::byte_range& range : detail::bitwise_ranges<T>())
+        {
+            std::memcpy(data + range.offset, this->consume(range.size), range.size);
+        }
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void binary_reader::read_elements(std::vector<T>& values, std::uint32_t size, std::false_type)
+    {
+        // The length is untrusted, so at most one element per remaining byte is reserved up front.
+        const std::size_t remaining = m_size - m_position;
+        values.clear();
+        values.reserve(size < remaining ? size : remaining);
+        for (std::uint32_t i = 0; i < size; ++i)
+        {
+            T element = T();
+            this->read_value(element);
+            values.push_back(std::move(element));
+        }
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void binary_reader::read_elements(std::vector<T>& values, std::uint32_t size, std::true_type)
+    {
+        if (!detail::is_little_endian() || !detail::is_bitwise_packed<T>())
+        {
+            this->read_elements(values, size, std::false_type());
+            return;
+        }
+
+        // The whole array is consumed before resizing, so a corrupt length cannot cause a large allocation.
+        const char* const data = this->consume(static_cast<std::size_t>(size) * sizeof(T));
+        values.resize(size);
+        if (size != 0)
+        {
+            std::memcpy(values.data(), data, static_cast<std::size_t>(size) * sizeof(T));
+        }
+    }
+
+    //====================
+    // Getters and setters
+    //====================
+    /**********************************************************/
+    inline bool binary_reader::at_end() const
+    {
+        return m_position == m_size;
+    }
+
+    /**********************************************************/
+    inline std::uint64_t binary_reader::fingerprint() const
+    {
+        if (m_size - m_position < sizeof(std::uint64_t))
+        {
+            throw detail::meta_exception("The binary archive is truncated.");
+        }
+
+        return detail::load_little_endian<std::uint64_t>(m_data + m_position);
+    }
+
+    //====================
+    // Methods
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    void binary_reader::read(Class& object)
+    {
+        static_assert(is_registered<Class>(), "Only registered classes can be read from an archive.");
+
+        if (this->fingerprint() != schema_fingerprint<Class>())
+        {
+            throw detail::meta_exception("The binary archive was written with a different schema.");
+        }
+
+        m_position += sizeof(std::uint64_t);
+        this->read_value(object);
+    }
+
+    //====================
+    // Functions
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    std::vector<char> to_binary(const Class& object)
+    {
+        binary_writer writer;
+        writer.write(object);
+        return std::vector<char>(writer.data(), writer.data() + writer.size());
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    void from_binary(const std::vector<char>& archive, Class& object)
+    {
+        binary_reader reader(archive.data(), archive.size());
+        reader.read(object);
+
+        if (!reader.at_end())
+        {
+            throw detail::meta_exception("Unexpected bytes after the object within the binary archive.");
+        }
+    }
+
+} // namespace reflect
\ No newline at end of file
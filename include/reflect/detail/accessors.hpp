@@ -0,0 +1,519 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_DETAIL_ACCESSORS_HPP_
+#define _REFLECT_DETAIL_ACCESSORS_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <type_traits> // Deducing the return types of getters.
+#include <utility>     // Forwarding values to setters.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Aliases
+        //====================
+        /** Specifies the type returned when invoking a getter method on a constant object. */
+        template <typename Class, typename Getter>
+        using getter_result_type = decltype((std::declval<const Class&>().*std::declval<Getter>())());
+
+        //====================
+        // Functions
+        //====================
+        /**
+         * @brief Invokes a setter method which takes an rvalue reference.
+         *
+         * If the value is an rvalue of the member type it is moved into the setter, otherwise
+         * a temporary is constructed from the value and moved into the setter.
+         *
+         * @param obj    The object instance to set the data within.
+         * @param setter The setter method to invoke.
+         * @param value  The value to pass to the setter.
+         */
+        template <typename Class, typename T, typename V>
+        void invoke_setter(Class& obj, void (Class::*setter)(T&&), V&& value);
+
+        /**
+         * @brief Invokes a setter method which takes a reference or a value.
+         *
+         * The value is forwarded to the setter, so a setter which takes its argument by value
+         * will have an rvalue moved into it.
+         *
+         * @param obj    The object instance to set the data within.
+         * @param setter The setter method to invoke.
+         * @param value  The value to pass to the setter.
+         */
+        template <typename Class, typename Setter, typename V>
+        void invoke_setter(Class& obj, Setter setter, V&& value);
+
+        //====================
+        // Classes
+        //====================
+        template <typename Class, typename T>
+        class member_accessor final
+        {
+        private:
+            //====================
+            // Member variables
+            //====================
+            /** A function pointer for a member variable of a class. */
+            member_ptr<Class, T> m_member;
+
+        public:
+            /** The type returned when retrieving the value through the accessor. */
+            using get_type = const T&;
+
+            //====================
+            // Ctors and dtor
+            //====================
+            /**
+             * @brief Constructor for binding a member variable to the accessor.
+             *
+             * @param member The member variable to bind.
+             */
+            constexpr explicit member_accessor(member_ptr<Class, T> member);
+
+            //====================
+            // Methods
+            //====================
+            /**
+             * @brief Retrieves a constant reference to the member variable.
+             *
+             * @param obj The object instance to return the data from.
+             *
+             * @returns A constant reference to the member variable.
+             */
+            const T& get(const Class& obj) const;
+
+            /**
+             * @brief Retrieves a copy of the member variable.
+             *
+             * @param obj The object instance to return the data from.
+             *
+             * @returns A copy of the member variable.
+             */
+            T get_copy(const Class& obj) const;
+
+            /**
+             * @brief Invokes the function with a constant reference to the member variable.
+             *
+             * @param obj The object instance to return the data from.
+             * @param f   The function to invoke with the data.
+             *
+             * @returns The result of the invoked function.
+             */
+            template <typename F>
+            decltype(auto) visit(const Class& obj, F&& f) const;
+
+            /**
+             * @brief Retrieves a reference to the member variable.
+             *
+             * @param obj The object instance to return the data from.
+             *
+             * @returns A reference to the member variable.
+             */
+            T& get_reference(Class& obj) const;
+
+            /**
+             * @brief Retrieves the bound member variable pointer.
+             *
+             * @returns The bound member variable pointer.
+             */
+            member_ptr<Class, T> get_member() const;
+
+            /**
+             * @brief Assigns the value directly to the member variable.
+             *
+             * The value is forwarded, so an rvalue is move assigned into the member variable.
+             *
+             * @param obj   The object instance to set the data within.
+             * @param value The value to assign.
+             */
+            template <typename V>
+            void set(Class& obj, V&& value) const;
+
+            /** @returns True, as the accessor is bound to a member variable. */
+            static constexpr bool has_member();
+            /** @returns False, as the accessor has no getter method. */
+            static constexpr bool has_getter();
+            /** @returns False, as the accessor has no setter method. */
+            static constexpr bool has_setter();
+            /** @returns True, as a member variable can always be referenced. */
+            static constexpr bool can_get_const_ref();
+        };
+
+        template <typename Class, typename T, typename Getter>
+        class readonly_accessor final
+        {
+        private:
+            //====================
+            // Member variables
+            //====================
+            /** A function pointer for a getter method, which returns either a reference or a value. */
+            Getter m_getter;
+
+        public:
+            /** The type returned when retrieving the value through the accessor. */
+            using get_type = getter_result_type<Class, Getter>;
+
+            //====================
+            // Ctors and dtor
+            //====================
+            /**
+             * @brief Constructor for binding a getter method to the accessor.
+             *
+             * @param getter The getter method to bind.
+             */
+            constexpr explicit readonly_accessor(Getter getter);
+
+            //====================
+            // Methods
+            //====================
+            /**
+             * @brief Invokes the getter method.
+             *
+             * @param obj The object instance to return the data from.
+             *
+             * @returns The result of the getter, either by constant reference or by value.
+             */
+            get_type get(const Class& obj) const;
+
+            /**
+             * @brief Retrieves a copy of the result of the getter method.
+             *
+             * @param obj The object instance to return the data from.
+             *
+             * @returns A copy of the underlying data.
+             */
+            T get_copy(const Class& obj) const;
+
+            /**
+             * @brief Invokes the function with the result of the getter method.
+             *
+             * The result is passed straight to the function, so a value returned by the getter
+             * is materialized once and lives until the function returns.
+             *
+             * @param obj The object instance to return the data from.
+             * @param f   The function to invoke with the data.
+             *
+             * @returns The result of the invoked function.
+             */
+            template <typename F>
+            decltype(auto) visit(const Class& obj, F&& f) const;
+
+            /**
+             * @brief Errorneous method, as no member variable is bound to the accessor.
+             *
+             * @throws meta_exception As no member pointer has been set.
+             */
+            T& get_reference(Class& obj) const;
+
+            /**
+             * @brief Errorneous method, as no member variable is bound to the accessor.
+             *
+             * @throws meta_exception As no member pointer has been set.
+             */
+            member_ptr<Class, T> get_member() const;
+
+            /**
+             * @brief Errorneous method, as the accessor is readonly.
+             *
+             * @throws meta_exception As no setter or member pointer has been set.
+             */
+            template <typename V>
+            void set(Class& obj, V&& value) const;
+
+            /** @returns False, as the accessor has no member variable. */
+            static constexpr bool has_member();
+            /** @returns True, as the accessor is bound to a getter method. */
+            static constexpr bool has_getter();
+            /** @returns False, as the accessor has no setter method. */
+            static constexpr bool has_setter();
+            /** @returns True if the getter returns a reference. */
+            static constexpr bool can_get_const_ref();
+        };
+
+        template <typename Class, typename T, typename Getter, typename Setter>
+        class function_accessor final
+        {
+        private:
+            //====================
+            // Member variables
+            //====================
+            /** A function pointer for a getter method, which returns either a reference or a value. */
+            Getter m_getter;
+            /** A function pointer for a setter method, which takes either a reference or a value. */
+            Setter m_setter;
+
+        public:
+            /** The type returned when retrieving the value through the accessor. */
+            using get_type = getter_result_type<Class, Getter>;
+
+            //====================
+            // Ctors and dtor
+            //====================
+            /**
+             * @brief Constructor for binding a getter and setter method to the accessor.
+             *
+             * @param getter The getter method to bind.
+             * @param setter The setter method to bind.
+             */
+            constexpr explicit function_accessor(Getter getter, Setter setter);
+
+            //====================
+            // Methods
+            //====================
+            /**
+             * @brief Invokes the getter method.
+             *
+             * @param obj The object instance to return the data from.
+             *
+             * @returns The result of the getter, either by constant reference or by value.
+             */
+            get_type get(const Class& obj) const;
+
+            /**
+             * @brief Retrieves a copy of the result of the getter method.
+             *
+             * @param obj The object instance to return the data from.
+             *
+             * @returns A copy of the underlying data.
+             */
+            T get_copy(const Class& obj) const;
+
+            /**
+             * @brief Invokes the function with the result of the getter method.
+             *
+             * The result is passed straight to the function, so a value returned by the getter
+             * is materialized once and lives until the function returns.
+             *
+             * @param obj The object instance to return the data from.
+             * @param f   The function to invoke with the data.
+             *
+             * @returns The result of the invoked function.
+             */
+            template <typename F>
+            decltype(auto) visit(const Class& obj, F&& f) const;
+
+            /**
+             * @brief Errorneous method, as no member variable is bound to the accessor.
+             *
+             * @throws meta_exception As no member pointer has been set.
+             */
+            T& get_reference(Class& obj) const;
+
+            /**
+             * @brief Errorneous method, as no member variable is bound to the accessor.
+             *
+             * @throws meta_exception As no member pointer has been set.
+             */
+            member_ptr<Class, T> get_member() const;
+
+            /**
+             * @brief Invokes the setter method with the value.
+             *
+             * The value is forwarded, so an rvalue is moved into a setter which takes its
+             * argument by value or by rvalue reference.
+             *
+             * @param obj   The object instance to set the data within.
+             * @param value The value to pass to the setter.
+             */
+            template <typename V>
+            void set(Class& obj, V&& value) const;
+
+            /** @returns False, as the accessor has no member variable. */
+            static constexpr bool has_member();
+            /** @returns True, as the accessor is bound to a getter method. */
+            static constexpr bool has_getter();
+            /** @returns True, as the accessor is bound to a setter method. */
+            static constexpr bool has_setter();
+            /** @returns True if the getter returns a reference. */
+            static constexpr bool can_get_const_ref();
+        };
+
+        template <typename Class, typename T>
+        class dynamic_accessor final
+        {
+        private:
+            //====================
+            // Member variables
+            //====================
+            /** A function pointer for a member variable of a class. */
+            member_ptr<Class, T>          m_member;
+            /** A function pointer for a getter method that returns a reference. */
+            ref_getter_func_ptr<Class, T> m_ref_getter;
+            /** A function pointer for a setter method that takes in a referenced argument. */
+            ref_setter_func_ptr<Class, T> m_ref_setter;
+            /** A function pointer for a getter method that returns an object by value. */
+            val_getter_func_ptr<Class, T> m_val_getter;
+            /** A function pointer for a setter method that takes in an argument by value. */
+            val_setter_func_ptr<Class, T> m_val_setter;
+
+        public:
+            /**
+             * The type returned when retrieving the value through the accessor.
+             *
+             * Which getter is bound is only known at runtime, so values are returned by value in case the
+             * getter returns a temporary, which a reference would be left dangling to.
+             */
+            using get_type = T;
+
+            //====================
+            // Ctors and dtor
+            //====================
+            /**
+             * @brief Constructor for binding a member variable to the accessor.
+             *
+             * @param member The member variable to bind.
+             */
+            explicit dynamic_accessor(member_ptr<Class, T> member);
+
+            /**
+             * @brief Constructor for binding a getter and setter which use referenced values.
+             *
+             * @param getter The getter function to bind.
+             * @param setter The setter function to bind.
+             */
+            explicit dynamic_accessor(ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
+
+            /**
+             * @brief Constructor for binding a getter and setter which use object values.
+             *
+             * @param getter The getter function to bind.
+             * @param setter The setter function to bind.
+             */
+            explicit dynamic_accessor(val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter);
+
+            /**
+             * @brief Constructor for binding a getter which returns a value and a setter which takes a reference.
+             *
+             * @param getter The getter function to bind.
+             * @param setter The setter function to bind.
+             */
+            explicit dynamic_accessor(val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
+
+            //====================
+            // Methods
+            //====================
+            /**
+             * @brief Retrieves the value through whichever getter or member pointer was bound.
+             *
+             * @param obj The object instance to return the data from.
+             *
+             * @returns A copy of the underlying mapped data.
+             *
+             * @throws meta_exception If no getter function or member pointer has been set.
+             */
+            get_type get(const Class& obj) const;
+
+            /**
+             * @brief Retrieves a copy through whichever getter or member pointer was bound.
+             *
+             * @param obj The object instance to return the data from.
+             *
+             * @returns A copy of the underlying mapped data.
+             *
+             * @throws meta_exception If no getter function or member pointer has been set.
+             */
+            T get_copy(const Class& obj) const;
+
+            /**
+             * @brief Invokes the function with the result of whichever getter or member pointer was bound.
+             *
+             * The result is passed straight to the function, so a value returned by a getter
+             * is materialized once and lives until the function returns.
+             *
+             * @param obj The object instance to return the data from.
+             * @param f   The function to invoke with the data.
+             *
+             * @returns The result of the invoked function.
+             *
+             * @throws meta_exception If no getter function or member pointer has been set.
+             */
+            template <typename F>
+            decltype(auto) visit(const Class& obj, F&& f) const;
+
+            /**
+             * @brief Retrieves a reference to the member variable if a member pointer was bound.
+             *
+             * @param obj The object instance to return the data from.
+             *
+             * @returns A reference to the underlying mapped data.
+             *
+             * @throws meta_exception If no member pointer has been set.
+             */
+            T& get_reference(Class& obj) const;
+
+            /**
+             * @brief Retrieves the member variable pointer if one was bound.
+             *
+             * @returns The bound member variable pointer.
+             *
+             * @throws meta_exception If no member pointer has been set.
+             */
+            member_ptr<Class, T> get_member() const;
+
+            /**
+             * @brief Sets the value through whichever setter or member pointer was bound.
+             *
+             * @param obj   The object instance to set the data within.
+             * @param value The value to set within the class.
+             *
+             * @throws meta_exception If no setter or member pointer has been set.
+             */
+            template <typename V>
+            void set(Class& obj, V&& value) const;
+
+            /** @returns True if a member pointer has been bound. */
+            bool has_member() const;
+            /** @returns True if a getter method has been bound. */
+            bool has_getter() const;
+            /** @returns True if a setter method has been bound. */
+            bool has_setter() const;
+            /** @returns True if a member pointer or a referenced getter has been bound. */
+            bool can_get_const_ref() const;
+        };
+
+        //====================
+        // Structs
+        //====================
+        /** Checks whether the accessor is bound directly to a member variable. */
+        template <typename Accessor>
+        struct is_member_accessor : std::false_type {};
+
+        /** Checks whether the accessor is bound directly to a member variable. */
+        template <typename Class, typename T>
+        struct is_member_accessor<member_accessor<Class, T>> : std::true_type {};
+
+    } // namespace detail
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "accessors.inl" // Method declarations.
+
+#endif//_REFLECT_DETAIL_ACCESSORS_HPP_
\ No newline at end of file
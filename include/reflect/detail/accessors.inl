@@ -0,0 +1,484 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+//====================
+// Reflect includes
+//====================
+#include "meta_exception.hpp" // Throwing meta exceptions.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**********************************************************/
+        template <typename T, typename V>
+        std::enable_if_t<std::is_same<V, T>::value, T&&> make_rvalue(std::remove_reference_t<V>& value)
+        {
+            return std::move(value);
+        }
+
+        /**********************************************************/
+        template <typename T, typename V>
+        std::enable_if_t<!std::is_same<V, T>::value, T> make_rvalue(std::remove_reference_t<V>& value)
+        {
+            return T(std::forward<V>(value));
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename V>
+        void invoke_setter(Class& obj, void (Class::*setter)(T&&), V&& value)
+        {
+            (obj.*setter)(make_rvalue<T, V>(value));
+        }
+
+        /**********************************************************/
+        template <typename Class, typename Setter, typename V>
+        void invoke_setter(Class& obj, Setter setter, V&& value)
+        {
+            (obj.*setter)(std::forward<V>(value));
+        }
+
+        //========================================
+        // member_accessor
+        //========================================
+        /**********************************************************/
+        template <typename Class, typename T>
+        constexpr member_accessor<Class, T>::member_accessor(member_ptr<Class, T> member)
+            : m_member(member)
+        {
+            // Empty.
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        const T& member_accessor<Class, T>::get(const Class& obj) const
+        {
+            return obj.*m_member;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        T member_accessor<Class, T>::get_copy(const Class& obj) const
+        {
+            return obj.*m_member;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        template <typename F>
+        decltype(auto) member_accessor<Class, T>::visit(const Class& obj, F&& f) const
+        {
+            return f(obj.*m_member);
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        T& member_accessor<Class, T>::get_reference(Class& obj) const
+        {
+            return obj.*m_member;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        member_ptr<Class, T> member_accessor<Class, T>::get_member() const
+        {
+            return m_member;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        template <typename V>
+        void member_accessor<Class, T>::set(Class& obj, V&& value) const
+        {
+            obj.*m_member = std::forward<V>(value);
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        constexpr bool member_accessor<Class, T>::has_member()
+        {
+            return true;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        constexpr bool member_accessor<Class, T>::has_getter()
+        {
+            return false;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        constexpr bool member_accessor<Class, T>::has_setter()
+        {
+            return false;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        constexpr bool member_accessor<Class, T>::can_get_const_ref()
+        {
+            return true;
+        }
+
+        //========================================
+        // readonly_accessor
+        //========================================
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter>
+        constexpr readonly_accessor<Class, T, Getter>::readonly_accessor(Getter getter)
+            : m_getter(getter)
+        {
+            // Empty.
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter>
+        typename readonly_accessor<Class, T, Getter>::get_type readonly_accessor<Class, T, Getter>::get(const Class& obj) const
+        {
+            return (obj.*m_getter)();
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter>
+        T readonly_accessor<Class, T, Getter>::get_copy(const Class& obj) const
+        {
+            return (obj.*m_getter)();
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter>
+        template <typename F>
+        decltype(auto) readonly_accessor<Class, T, Getter>::visit(const Class& obj, F&& f) const
+        {
+            return f((obj.*m_getter)());
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter>
+        T& readonly_accessor<Class, T, Getter>::get_reference(Class&) const
+        {
+            throw meta_exception("Cannot return reference of member variable: no member pointer set.");
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter>
+        member_ptr<Class, T> readonly_accessor<Class, T, Getter>::get_member() const
+        {
+            throw meta_exception("Cannot retrieve pointer to member variable: no member pointer set.");
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter>
+        template <typename V>
+        void readonly_accessor<Class, T, Getter>::set(Class&, V&&) const
+        {
+            throw meta_exception("Cannot set value: no setters or member pointer set.");
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter>
+        constexpr bool readonly_accessor<Class, T, Getter>::has_member()
+        {
+            return false;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter>
+        constexpr bool readonly_accessor<Class, T, Getter>::has_getter()
+        {
+            return true;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter>
+        constexpr bool readonly_accessor<Class, T, Getter>::has_setter()
+        {
+            return false;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter>
+        constexpr bool readonly_accessor<Class, T, Getter>::can_get_const_ref()
+        {
+            return std::is_reference<get_type>::value;
+        }
+
+        //========================================
+        // function_accessor
+        //========================================
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter, typename Setter>
+        constexpr function_accessor<Class, T, Getter, Setter>::function_accessor(Getter getter, Setter setter)
+            : m_getter(getter), m_setter(setter)
+        {
+            // Empty.
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter, typename Setter>
+        typename function_accessor<Class, T, Getter, Setter>::get_type function_accessor<Class, T, Getter, Setter>::get(const Class& obj) const
+        {
+            return (obj.*m_getter)();
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter, typename Setter>
+        T function_accessor<Class, T, Getter, Setter>::get_copy(const Class& obj) const
+        {
+            return (obj.*m_getter)();
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter, typename Setter>
+        template <typename F>
+        decltype(auto) function_accessor<Class, T, Getter, Setter>::visit(const Class& obj, F&& f) const
+        {
+            return f((obj.*m_getter)());
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter, typename Setter>
+        T& function_accessor<Class, T, Getter, Setter>::get_reference(Class&) const
+        {
+            throw meta_exception("Cannot return reference of member variable: no member pointer set.");
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter, typename Setter>
+        member_ptr<Class, T> function_accessor<Class, T, Getter, Setter>::get_member() const
+        {
+            throw meta_exception("Cannot retrieve pointer to member variable: no member pointer set.");
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter, typename Setter>
+        template <typename V>
+        void function_accessor<Class, T, Getter, Setter>::set(Class& obj, V&& value) const
+        {
+            invoke_setter(obj, m_setter, std::forward<V>(value));
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter, typename Setter>
+        constexpr bool function_accessor<Class, T, Getter, Setter>::has_member()
+        {
+            return false;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter, typename Setter>
+        constexpr bool function_accessor<Class, T, Getter, Setter>::has_getter()
+        {
+            return true;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter, typename Setter>
+        constexpr bool function_accessor<Class, T, Getter, Setter>::has_setter()
+        {
+            return true;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T, typename Getter, typename Setter>
+        constexpr bool function_accessor<Class, T, Getter, Setter>::can_get_const_ref()
+        {
+            return std::is_reference<get_type>::value;
+        }
+
+        //========================================
+        // dynamic_accessor
+        //========================================
+        /**********************************************************/
+        template <typename Class, typename T>
+        dynamic_accessor<Class, T>::dynamic_accessor(member_ptr<Class, T> member)
+            : m_member(member), m_ref_getter(nullptr), m_ref_setter(nullptr), m_val_getter(nullptr), m_val_setter(nullptr)
+        {
+            // Empty.
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        dynamic_accessor<Class, T>::dynamic_accessor(ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter)
+            : m_member(nullptr), m_ref_getter(getter), m_ref_setter(setter), m_val_getter(nullptr), m_val_setter(nullptr)
+        {
+            // Empty.
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        dynamic_accessor<Class, T>::dynamic_accessor(val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter)
+            : m_member(nullptr), m_ref_getter(nullptr), m_ref_setter(nullptr), m_val_getter(getter), m_val_setter(setter)
+        {
+            // Empty.
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        dynamic_accessor<Class, T>::dynamic_accessor(val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter)
+            : m_member(nullptr), m_ref_getter(nullptr), m_ref_setter(setter), m_val_getter(getter), m_val_setter(nullptr)
+        {
+            // Empty.
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        typename dynamic_accessor<Class, T>::get_type dynamic_accessor<Class, T>::get(const Class& obj) const
+        {
+            if (m_ref_getter)
+            {
+                return (obj.*m_ref_getter)();
+            }
+            else if (m_val_getter)
+            {
+                return (obj.*m_val_getter)();
+            }
+            else if (m_member)
+            {
+                return obj.*m_member;
+            }
+
+            throw meta_exception("Cannot return member variable: no getter function or member pointer set.");
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        T dynamic_accessor<Class, T>::get_copy(const Class& obj) const
+        {
+            if (m_val_getter)
+            {
+                return (obj.*m_val_getter)();
+            }
+            else if (m_ref_getter)
+            {
+                return (obj.*m_ref_getter)();
+            }
+            else if (m_member)
+            {
+                return obj.*m_member;
+            }
+
+            throw meta_exception("Cannot return copy of member variable: no getter function or member pointer set.");
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        template <typename F>
+        decltype(auto) dynamic_accessor<Class, T>::visit(const Class& obj, F&& f) const
+        {
+            if (m_ref_getter)
+            {
+                return f((obj.*m_ref_getter)());
+            }
+            else if (m_val_getter)
+            {
+                return f((obj.*m_val_getter)());
+            }
+            else if (m_member)
+            {
+                return f(obj.*m_member);
+            }
+
+            throw meta_exception("Cannot visit member variable: no getter function or member pointer set.");
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        T& dynamic_accessor<Class, T>::get_reference(Class& obj) const
+        {
+            if (m_member)
+            {
+                return obj.*m_member;
+            }
+
+            throw meta_exception("Cannot return reference of member variable: no member pointer set.");
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        member_ptr<Class, T> dynamic_accessor<Class, T>::get_member() const
+        {
+            if (m_member)
+            {
+                return m_member;
+            }
+
+            throw meta_exception("Cannot retrieve pointer to member variable: no member pointer set.");
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        template <typename V>
+        void dynamic_accessor<Class, T>::set(Class& obj, V&& value) const
+        {
+            if (m_ref_setter)
+            {
+                (obj.*m_ref_setter)(value);
+            }
+            else if (m_val_setter)
+            {
+                (obj.*m_val_setter)(std::forward<V>(value));
+            }
+            else if (m_member)
+            {
+                obj.*m_member = std::forward<V>(value);
+            }
+            else
+            {
+                throw meta_exception("Cannot set value: no setters or member pointer set.");
+            }
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        bool dynamic_accessor<Class, T>::has_member() const
+        {
+            return m_member != nullptr;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        bool dynamic_accessor<Class, T>::has_getter() const
+        {
+            return m_ref_getter || m_val_getter;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        bool dynamic_accessor<Class, T>::has_setter() const
+        {
+            return m_ref_setter || m_val_setter;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename T>
+        bool dynamic_accessor<Class, T>::can_get_const_ref() const
+        {
+            return m_member || m_ref_getter;
+        }
+
+    } // namespace detail
+} // namespace reflect
\ No newline at end of file
@@ -0,0 +1,189 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_DETAIL_BITWISE_LAYOUT_HPP_
+#define _REFLECT_DETAIL_BITWISE_LAYOUT_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef>     // Offsets and sizes of the member byte ranges.
+#include <tuple>       // Inspecting the registered properties.
+#include <type_traits> // Detecting trivially copyable classes.
+#include <vector>      // Storing the member byte ranges.
+
+//====================
+// Reflect includes
+//====================
+#include "accessors.hpp"     // Detecting properties bound to member variables.
+#include "../meta_class.hpp" // Iterating the registered properties.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Structs
+        //====================
+        /** Checks whether every condition within the pack is true. */
+        template <bool... Conditions>
+        struct all_of : std::is_same<all_of<true, Conditions...>, all_of<Conditions..., true>> {};
+
+        /** A contiguous range of bytes within an object, occupied by one or more members. */
+        struct byte_range
+        {
+            /** The offset of the first byte from the start of the object. */
+            std::size_t offset;
+            /** The number of bytes within the range. */
+            std::size_t size;
+        };
+
+        /**
+         * Checks whether the value of a type is fully described by its bytes.
+         *
+         * Arithmetic types, except for booleans which may only hold two of their byte values, and enums
+         * are copyable as bytes. Floating point numbers are not comparable as bytes, as their equality
+         * differs for zeros and NaNs.
+         */
+        template <typename T, typename = void>
+        struct bitwise_traits
+        {
+            /** True if the value can be copied and archived through its bytes. */
+            static constexpr bool copyable = (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value) || std::is_enum<T>::value;
+            /** True if the value can also be compared through its bytes. */
+            static constexpr bool comparable = copyable && !std::is_floating_point<T>::value;
+        };
+
+        /** Checks the registered properties of a class, which must all be bound directly to bitwise member variables. */
+        template <typename Class, typename Properties>
+        struct bitwise_members;
+
+        /** Checks the registered properties of a class, which must all be bound directly to bitwise member variables. */
+        template <typename Class, typename... Properties>
+        struct bitwise_members<Class, std::tuple<Properties...>>
+        {
+            /** True if the class is trivially copyable and every property is a copyable member variable. */
+            static constexpr bool copyable = std::is_trivially_copyable<Class>::value && sizeof...(Properties) != 0 &&
+                all_of<(is_member_accessor<typename Properties::accessor_type>::value && bitwise_traits<typename Properties::member_type>::copyable)...>::value;
+            /** True if the class is copyable and every property is also comparable. */
+            static constexpr bool comparable = copyable && all_of<bitwise_traits<typename Properties::member_type>::comparable...>::value;
+        };
+
+        /**
+         * Checks whether the value of a registered class is fully described by the bytes of its registered member variables.
+         *
+         * This is the case for trivially copyable classes, such as plain structs, that only register member
+         * pointers to bitwise types or other such classes.
+         */
+        template <typename T>
+        struct bitwise_traits<T, std::enable_if_t<is_registered<T>()>> : bitwise_members<T, std::decay_t<decltype(register_class<T>())>> {};
+
+        //====================
+        // Functions
+        //====================
+        /**
+         * @brief Checks whether the host stores integers with the least significant byte first.
+         *
+         * @returns True on little-endian hosts.
+         */
+        bool is_little_endian();
+
+        /**
+         * @brief Retrieves the byte ranges occupied by the registered member variables of a bitwise type.
+         *
+         * The offsets of the members are taken from the registered member pointers, descending into nested
+         * registered classes, and are computed once per type. The ranges are in registration order, and
+         * members which are adjacent in memory are merged into a single range.
+         *
+         * @returns The byte ranges of the registered member variables.
+         */
+        template <typename T>
+        const std::vector<byte_range>& bitwise_ranges();
+
+        /**
+         * @brief Checks whether the registered member variables of a bitwise type cover all of its bytes.
+         *
+         * If so, the registered members are stored in registration order without padding, and arrays of
+         * the type can be copied as a single range of bytes.
+         *
+         * @returns True if the type is packed.
+         */
+        template <typename T, typename = std::enable_if_t<bitwise_traits<T>::copyable>>
+        bool is_bitwise_packed();
+
+        /**
+         * @brief Checks whether the registered member variables of a type cover all of its bytes.
+         *
+         * This function is only created for types that are not bitwise, so it is always false.
+         *
+         * @returns False.
+         */
+        template <typename T, typename = std::enable_if_t<!bitwise_traits<T>::copyable>, typename = void>
+        bool is_bitwise_packed();
+
+        /**
+         * @brief Appends the byte range of a bitwise member variable, merging it with the previous range if they are adjacent.
+         *
+         * @param ranges The ranges to append to.
+         * @param offset The offset of the member variable.
+         */
+        template <typename T, typename = std::enable_if_t<!is_registered<T>()>>
+        void append_bitwise_ranges(std::vector<byte_range>& ranges, std::size_t offset);
+
+        /**
+         * @brief Appends the byte ranges of the registered member variables of a nested bitwise class.
+         *
+         * @param ranges The ranges to append to.
+         * @param offset The offset of the nested class.
+         */
+        template <typename T, typename = std::enable_if_t<is_registered<T>()>, typename = void>
+        void append_bitwise_ranges(std::vector<byte_range>& ranges, std::size_t offset);
+
+        /**
+         * @brief Copies the registered member variables of a bitwise type as ranges of bytes.
+         *
+         * @param source      The object to copy from.
+         * @param destination The object to copy to.
+         */
+        template <typename T>
+        void copy_bitwise(const T& source, T& destination);
+
+        /**
+         * @brief Compares the registered member variables of a bitwise comparable type as ranges of bytes.
+         *
+         * @param lhs The first object to compare.
+         * @param rhs The second object to compare.
+         *
+         * @returns True if the bytes of every registered member are equal.
+         */
+        template <typename T>
+        bool equal_bitwise(const T& lhs, const T& rhs);
+
+    } // namespace detail
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "bitwise_layout.inl" // Method declarations.
+
+#endif//_REFLECT_DETAIL_BITWISE_LAYOUT_HPP_
\ No newline at end of file
@@ -0,0 +1,145 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+//====================
+// C++ includes
+//====================
+#include <cstdint> // Detecting the byte order of the host.
+#include <cstring> // Copying and comparing bytes.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**********************************************************/
+        inline bool is_little_endian()
+        {
+            const std::uint16_t value = 1;
+            unsigned char first;
+            std::memcpy(&first, &value, 1);
+
+            return first == 1;
+        }
+
+        /**********************************************************/
+        template <typename T>
+        const std::vector<byte_range>& bitwise_ranges()
+        {
+            static_assert(bitwise_traits<T>::copyable, "Only bitwise types have byte ranges.");
+
+            static const std::vector<byte_range> ranges = [] {
+                std::vector<byte_range> result;
+                append_bitwise_ranges<T>(result, 0);
+                return result;
+            }();
+
+            return ranges;
+        }
+
+        /**********************************************************/
+        template <typename T, typename>
+        bool is_bitwise_packed()
+        {
+            static const bool packed = [] {
+                const std::vector<byte_range>& ranges = bitwise_ranges<T>();
+                return ranges.size() == 1 && ranges[0].offset == 0 && ranges[0].size == sizeof(T);
+            }();
+
+            return packed;
+        }
+
+        /**********************************************************/
+        template <typename T, typename, typename>
+        bool is_bitwise_packed()
+        {
+            return false;
+        }
+
+        /**********************************************************/
+        template <typename T, typename>
+        void append_bitwise_ranges(std::vector<byte_range>& ranges, std::size_t offset)
+        {
+            if (!ranges.empty() && ranges.back().offset + ranges.back().size == offset)
+            {
+                ranges.back().size += sizeof(T);
+            }
+            else
+            {
+                ranges.push_back(byte_range{ offset, sizeof(T) });
+            }
+        }
+
+        /**********************************************************/
+        template <typename T, typename, typename>
+        void append_bitwise_ranges(std::vector<byte_range>& ranges, std::size_t offset)
+        {
+            // Member offsets cannot be evaluated at compile time, so they are measured within uninitialised storage.
+            const std::aligned_storage_t<sizeof(T), alignof(T)> storage = {};
+            const T& object = reinterpret_cast<const T&>(storage);
+            const char* const base = reinterpret_cast<const char*>(&storage);
+
+            for_tuple([&ranges, offset, &object, base](const auto& member) {
+                using member_type = typename std::decay_t<decltype(member)>::member_type;
+
+                const char* const address = reinterpret_cast<const char*>(&(object.*member.get_member()));
+                append_bitwise_ranges<member_type>(ranges, offset + static_cast<std::size_t>(address - base));
+            }, get_members<T>());
+        }
+
+        /**********************************************************/
+        template <typename T>
+        void copy_bitwise(const T& source, T& destination)
+        {
+            const char* const from = reinterpret_cast<const char*>(&source);
+            char* const to = reinterpret_cast<char*>(&destination);
+
+            for (const byte_range& range : bitwise_ranges<T>())
+            {
+                std::memmove(to + range.offset, from + range.offset, range.size);
+            }
+        }
+
+        /**********************************************************/
+        template <typename T>
+        bool equal_bitwise(const T& lhs, const T& rhs)
+        {
+            static_assert(bitwise_traits<T>::comparable, "Only bitwise comparable types can be compared as bytes.");
+
+            const char* const left = reinterpret_cast<const char*>(&lhs);
+            const char* const right = reinterpret_cast<const char*>(&rhs);
+
+            for (const byte_range& range : bitwise_ranges<T>())
+            {
+                if (std::memcmp(left + range.offset, right + range.offset, range.size) != 0)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    } // namespace detail
+} // namespace reflect
\ No newline at end of file
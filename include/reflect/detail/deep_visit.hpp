@@ -0,0 +1,103 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_DETAIL_DEEP_VISIT_HPP_
+#define _REFLECT_DETAIL_DEEP_VISIT_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <string>      // Storing the dotted paths.
+#include <type_traits> // Selecting between leaf members and nested classes.
+#include <vector>      // Storing the paths of every leaf member.
+
+//====================
+// Reflect includes
+//====================
+#include "../string_view.hpp"  // Passing the paths to the visitor.
+#include "template_helpers.hpp" // Iterating the registered properties.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**
+         * @brief Appends the path of a leaf member, which is not a registered class.
+         *
+         * @param prefix The dotted path of the member.
+         * @param paths  The paths to append to.
+         */
+        template <typename T, typename = std::enable_if_t<!is_registered<T>()>>
+        void append_deep_paths(const std::string& prefix, std::vector<std::string>& paths);
+
+        /**
+         * @brief Appends the paths of every leaf member within a registered class, in depth-first order.
+         *
+         * @param prefix The dotted path of the class, or an empty string for the outermost class.
+         * @param paths  The paths to append to.
+         */
+        template <typename T, typename = std::enable_if_t<is_registered<T>()>, typename = void>
+        void append_deep_paths(const std::string& prefix, std::vector<std::string>& paths);
+
+        /**
+         * @brief Retrieves the dotted path of every leaf member within a registered class.
+         *
+         * Each path joins the names of the nested properties with dots, such as "position.x". The paths
+         * are built once per class, in the order the leaf members are visited.
+         *
+         * @returns The paths of the leaf members.
+         */
+        template <typename Class>
+        const std::vector<std::string>& deep_paths();
+
+        /**
+         * @brief Invokes the function with the path and value of a leaf member.
+         *
+         * @param value The value of the member.
+         * @param f     The function to invoke.
+         * @param path  The path of the member, which is advanced to the path of the next leaf.
+         */
+        template <typename T, typename F, typename = std::enable_if_t<!is_registered<T>()>>
+        void visit_leaves(const T& value, F& f, const std::string*& path);
+
+        /**
+         * @brief Descends into each registered property of a nested class.
+         *
+         * @param value The nested object.
+         * @param f     The function to invoke on every leaf member.
+         * @param path  The path of the first leaf member, which is advanced past every leaf of the class.
+         */
+        template <typename T, typename F, typename = std::enable_if_t<is_registered<T>()>, typename = void>
+        void visit_leaves(const T& value, F& f, const std::string*& path);
+
+    } // namespace detail
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "deep_visit.inl" // Method declarations.
+
+#endif//_REFLECT_DETAIL_DEEP_VISIT_HPP_
\ No newline at end of file
@@ -0,0 +1,84 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**********************************************************/
+        template <typename T, typename>
+        void append_deep_paths(const std::string& prefix, std::vector<std::string>& paths)
+        {
+            paths.push_back(prefix);
+        }
+
+        /**********************************************************/
+        template <typename T, typename, typename>
+        void append_deep_paths(const std::string& prefix, std::vector<std::string>& paths)
+        {
+            for_tuple([&prefix, &paths](const auto& member) {
+                using member_type = typename std::decay_t<decltype(member)>::member_type;
+
+                const string_view name = member.get_name();
+                std::string path = prefix.empty() ? std::string() : prefix + '.';
+                path.append(name.data(), name.size());
+
+                append_deep_paths<member_type>(path, paths);
+            }, get_members<T>());
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        const std::vector<std::string>& deep_paths()
+        {
+            static const std::vector<std::string> paths = [] {
+                std::vector<std::string> result;
+                append_deep_paths<Class>(std::string(), result);
+                return result;
+            }();
+
+            return paths;
+        }
+
+        /**********************************************************/
+        template <typename T, typename F, typename>
+        void visit_leaves(const T& value, F& f, const std::string*& path)
+        {
+            f(string_view(*path++), value);
+        }
+
+        /**********************************************************/
+        template <typename T, typename F, typename, typename>
+        void visit_leaves(const T& value, F& f, const std::string*& path)
+        {
+            for_tuple([&value, &f, &path](const auto& member) {
+                member.visit(value, [&f, &path](const auto& nested) {
+                    visit_leaves(nested, f, path);
+                });
+            }, get_members<T>());
+        }
+
+    } // namespace detail
+} // namespace reflect
\ No newline at end of file
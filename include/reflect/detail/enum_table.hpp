@@ -0,0 +1,151 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_DETAIL_ENUM_TABLE_HPP_
+#define _REFLECT_DETAIL_ENUM_TABLE_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef>     // Sizes and indices.
+#include <cstdint>     // Compact positions of the entries.
+#include <type_traits> // Retrieving the underlying type of enumerations.
+
+//====================
+// Reflect includes
+//====================
+#include "../string_view.hpp" // Names of the registered enum values.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Structs
+        //====================
+        template <typename T>
+        struct enum_entry
+        {
+            /** The registered name of the enum value. */
+            string_view name;
+            /** The enum value mapped to the name. */
+            T value = T();
+        };
+
+        template <typename T, std::size_t N>
+        class enum_table final
+        {
+            // Tables of a different size are needed to insert entries when building the table.
+            template <typename, std::size_t>
+            friend class enum_table;
+
+        private:
+            //====================
+            // Aliases
+            //====================
+            /** The integral type used to order and index the enum values. */
+            using underlying_type = std::underlying_type_t<T>;
+
+            /** The smallest integral type able to index every entry, to keep the name order compact. */
+            using position_type = std::conditional_t<(N <= UINT8_MAX), std::uint8_t,
+                                  std::conditional_t<(N <= UINT16_MAX), std::uint16_t, std::size_t>>;
+
+            //====================
+            // Member variables
+            //====================
+            /** The number of entries that can be stored, as zero sized arrays are not allowed. */
+            static constexpr std::size_t capacity = N > 0 ? N : 1;
+
+            /** The entries sorted by their underlying value. */
+            enum_entry<T> m_entries[capacity];
+            /** The positions of the entries sorted by their name. */
+            position_type m_by_name[capacity];
+            /** True if the values are unique and contiguous, so they can be indexed directly. */
+            bool m_dense;
+
+        public:
+            //====================
+            // Ctors and dtor
+            //====================
+            /**
+             * @brief Constructor for creating an empty table.
+             */
+            constexpr enum_table();
+
+            /**
+             * @brief Constructor for creating a table with one more entry than an existing table.
+             *
+             * The entry is inserted into both sorted orders, so lookups never need to sort at runtime.
+             * Once constructed the table is never modified, so it can be shared between threads.
+             *
+             * @param table The table containing the previously registered entries.
+             * @param name  The name of the enum value, which must outlive the table.
+             * @param value The enum value.
+             */
+            template <std::size_t M, typename = std::enable_if_t<M + 1 == N>>
+            constexpr enum_table(const enum_table<T, M>& table, string_view name, T value);
+
+            /**
+             * @brief Default destructor.
+             */
+            ~enum_table() = default;
+
+            //====================
+            // Methods
+            //====================
+            /**
+             * @brief Finds the entry registered with the specified value.
+             *
+             * Contiguous enumerations are indexed directly, otherwise the entries are binary searched.
+             *
+             * @param value The enum value to search for.
+             *
+             * @returns The matching entry, or nullptr if the value has not been registered.
+             */
+            constexpr const enum_entry<T>* find_value(T value) const;
+
+            /**
+             * @brief Finds the entry registered with the specified name.
+             *
+             * @param name The name to search for.
+             *
+             * @returns The matching entry, or nullptr if the name has not been registered.
+             */
+            constexpr const enum_entry<T>* find_name(string_view name) const;
+
+            /**
+             * @brief Retrieves the number of registered entries.
+             *
+             * @returns The number of entries within the table.
+             */
+            static constexpr std::size_t size();
+        };
+
+    } // namespace detail
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "enum_table.inl" // Method declarations.
+
+#endif//_REFLECT_DETAIL_ENUM_TABLE_HPP_
\ No newline at end of file
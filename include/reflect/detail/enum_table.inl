@@ -0,0 +1,158 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Ctors and dtor
+        //====================
+        /**********************************************************/
+        template <typename T, std::size_t N>
+        constexpr enum_table<T, N>::enum_table()
+            : m_entries(), m_by_name(), m_dense(true)
+        {
+            static_assert(N == 0, "Only an empty table can be default constructed.");
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t N>
+        template <std::size_t M, typename>
+        constexpr enum_table<T, N>::enum_table(const enum_table<T, M>& table, string_view name, T value)
+            : m_entries(), m_by_name(), m_dense(true)
+        {
+            const underlying_type key = static_cast<underlying_type>(value);
+
+            // Insert the entry after any entries with a lower or equal value.
+            std::size_t position = 0;
+            while (position < M && static_cast<underlying_type>(table.m_entries[position].value) <= key)
+            {
+                ++position;
+            }
+
+            for (std::size_t i = 0; i < M; ++i)
+            {
+                m_entries[i < position ? i : i + 1] = table.m_entries[i];
+            }
+            m_entries[position] = enum_entry<T>{ name, value };
+
+            // Insert the position of the entry after any names which order before or equal to it, and
+            // shift the positions of the entries that were moved along by the insertion.
+            std::size_t name_position = 0;
+            while (name_position < M && !(name < table.m_entries[table.m_by_name[name_position]].name))
+            {
+                ++name_position;
+            }
+
+            for (std::size_t i = 0; i < M; ++i)
+            {
+                const std::size_t moved = table.m_by_name[i] < position ? table.m_by_name[i] : table.m_by_name[i] + 1;
+                m_by_name[i < name_position ? i : i + 1] = static_cast<position_type>(moved);
+            }
+            m_by_name[name_position] = static_cast<position_type>(position);
+
+            for (std::size_t i = 1; i < N; ++i)
+            {
+                const underlying_type previous = static_cast<underlying_type>(m_entries[i - 1].value);
+                const underlying_type current = static_cast<underlying_type>(m_entries[i].value);
+                if (current == previous || current - 1 != previous)
+                {
+                    m_dense = false;
+                }
+            }
+        }
+
+        //====================
+        // Methods
+        //====================
+        /**********************************************************/
+        template <typename T, std::size_t N>
+        constexpr const enum_entry<T>* enum_table<T, N>::find_value(T value) const
+        {
+            if (N == 0)
+            {
+                return nullptr;
+            }
+
+            const underlying_type key = static_cast<underlying_type>(value);
+            if (m_dense)
+            {
+                const underlying_type first = static_cast<underlying_type>(m_entries[0].value);
+                const underlying_type last = static_cast<underlying_type>(m_entries[N - 1].value);
+                if (key < first || key > last)
+                {
+                    return nullptr;
+                }
+
+                return &m_entries[static_cast<std::size_t>(key - first)];
+            }
+
+            std::size_t low = 0;
+            std::size_t high = N;
+            while (low < high)
+            {
+                const std::size_t middle = low + (high - low) / 2;
+                if (static_cast<underlying_type>(m_entries[middle].value) < key)
+                {
+                    low = middle + 1;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+
+            return low < N && m_entries[low].value == value ? &m_entries[low] : nullptr;
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t N>
+        constexpr const enum_entry<T>* enum_table<T, N>::find_name(string_view name) const
+        {
+            std::size_t low = 0;
+            std::size_t high = N;
+            while (low < high)
+            {
+                const std::size_t middle = low + (high - low) / 2;
+                if (m_entries[m_by_name[middle]].name < name)
+                {
+                    low = middle + 1;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+
+            return low < N && m_entries[m_by_name[low]].name == name ? &m_entries[m_by_name[low]] : nullptr;
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t N>
+        constexpr std::size_t enum_table<T, N>::size()
+        {
+            return N;
+        }
+
+    } // namespace detail
+} // namespace reflect
\ No newline at end of file
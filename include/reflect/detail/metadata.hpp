@@ -29,6 +29,11 @@
 #include <tuple>  // Each registered property is a tuple.
 #include <string> // Registering the name of a class.
 
+//====================
+// Reflect includes
+//====================
+#include "name_index.hpp" // Looking up properties by name.
+
 namespace reflect
 {
     namespace detail
@@ -40,7 +45,7 @@ namespace reflect
             // Member variables
             //====================
             /** Invoked to register relevant classes to the meta engine. */
-            static Type members;
+            static const Type members;
 
             //====================
             // Methods
@@ -54,6 +59,20 @@ namespace reflect
             {
                 return register_name<T>();
             }
+
+            /**
+             * @brief Retrieves the name index of the registered properties.
+             * 
+             * The index is lazily built from the registered members the first time it is requested,
+             * and maps the name of each property to its position within the tuple.
+             * 
+             * @returns The index of the registered property names.
+             */
+            static const name_index<std::tuple_size<Type>::value>& index()
+            {
+                static const name_index<std::tuple_size<Type>::value> names(members);
+                return names;
+            }
         };
 
         //====================
@@ -61,7 +80,7 @@ namespace reflect
         //====================
         /**********************************************************/
         template <typename T, typename Type>
-        Type metadata_t<T, Type>::members = register_class<T>();
+        const Type metadata_t<T, Type>::members = register_class<T>();
 
     } // namespace detail
 } // namespace reflect
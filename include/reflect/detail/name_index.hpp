@@ -0,0 +1,145 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_DETAIL_NAME_INDEX_HPP_
+#define _REFLECT_DETAIL_NAME_INDEX_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <array>   // Fixed size slot storage.
+#include <cstddef> // Sizes and indices.
+
+//====================
+// Reflect includes
+//====================
+#include "../string_view.hpp" // Names of the registered properties.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**
+         * @brief Generates a FNV-1a hash for the specified sequence of characters.
+         *
+         * @param str  The characters to hash.
+         * @param size The number of characters to hash.
+         *
+         * @returns The hash of the character sequence.
+         */
+        constexpr std::size_t hash_name(const char* str, std::size_t size);
+
+        /**
+         * @brief Calculates the smallest power of two that is greater than or equal to the given value.
+         *
+         * @param value The value to round.
+         *
+         * @returns The rounded power of two.
+         */
+        constexpr std::size_t next_power_of_two(std::size_t value);
+
+        template <std::size_t N>
+        class name_index final
+        {
+        private:
+            //====================
+            // Structs
+            //====================
+            struct slot
+            {
+                /** The hash of the name stored in the slot. */
+                std::size_t        hash;
+                /** The name of the property stored in the slot. */
+                string_view name;
+                /** The position of the property within the registered tuple, or N if the slot is empty. */
+                std::size_t        index;
+            };
+
+            //====================
+            // Member variables
+            //====================
+            /** The number of slots, kept at least twice the number of properties to keep probe chains short. */
+            static constexpr std::size_t capacity = next_power_of_two(N * 2);
+
+            /** The open addressed table of registered names. */
+            std::array<slot, capacity> m_slots;
+
+        public:
+            //====================
+            // Ctors and dtor
+            //====================
+            /**
+             * @brief Deleting the default constructor.
+             *
+             * The index must always be built from the registered properties of a class.
+             */
+            explicit name_index() = delete;
+
+            /**
+             * @brief Constructor for building the index from the registered properties of a class.
+             *
+             * When this constructor is invoked, the name of each property within the tuple is hashed
+             * and inserted into the table alongside its position within the tuple. The names are viewed
+             * rather than copied, so the tuple must outlive the index.
+             *
+             * @param members The tuple of registered properties.
+             */
+            template <typename Tuple>
+            explicit name_index(const Tuple& members);
+
+            /**
+             * @brief Default destructor.
+             */
+            ~name_index() = default;
+
+            //====================
+            // Methods
+            //====================
+            /**
+             * @brief Retrieves the position of a registered property within the tuple.
+             *
+             * @param name The name of the property to search for.
+             *
+             * @returns The index of the property, or N if no property has been registered with the name.
+             */
+            std::size_t find(string_view name) const;
+
+            /**
+             * @brief Retrieves the number of properties stored within the index.
+             *
+             * @returns The number of indexed properties.
+             */
+            static constexpr std::size_t size();
+        };
+
+    } // namespace detail
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "name_index.inl" // Method declarations.
+
+#endif//_REFLECT_DETAIL_NAME_INDEX_HPP_
\ No newline at end of file
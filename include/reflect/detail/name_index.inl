@@ -0,0 +1,124 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+//====================
+// Reflect includes
+//====================
+#include "template_helpers.hpp" // Iterating the registered tuple.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**********************************************************/
+        constexpr std::size_t hash_name(const char* str, std::size_t size)
+        {
+            std::size_t hash = static_cast<std::size_t>(14695981039346656037ull);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                hash ^= static_cast<unsigned char>(str[i]);
+                hash *= static_cast<std::size_t>(1099511628211ull);
+            }
+
+            return hash;
+        }
+
+        /**********************************************************/
+        constexpr std::size_t next_power_of_two(std::size_t value)
+        {
+            std::size_t result = 1;
+            while (result < value)
+            {
+                result <<= 1;
+            }
+
+            return result;
+        }
+
+        //========================================
+        // name_index
+        //========================================
+        //====================
+        // Ctors and dtor
+        //====================
+        /**********************************************************/
+        template <std::size_t N>
+        template <typename Tuple>
+        name_index<N>::name_index(const Tuple& members)
+            : m_slots()
+        {
+            for (auto& s : m_slots)
+            {
+                s = slot{ 0, string_view(), N };
+            }
+
+            std::size_t index = 0;
+            for_tuple([this, &index](const auto& member) {
+                const string_view name = member.get_name();
+                const std::size_t hash = hash_name(name.data(), name.size());
+
+                std::size_t position = hash & (capacity - 1);
+                while (m_slots[position].index != N)
+                {
+                    position = (position + 1) & (capacity - 1);
+                }
+
+                m_slots[position] = slot{ hash, name, index++ };
+            }, members);
+        }
+
+        //====================
+        // Methods
+        //====================
+        /**********************************************************/
+        template <std::size_t N>
+        std::size_t name_index<N>::find(string_view name) const
+        {
+            const std::size_t hash = hash_name(name.data(), name.size());
+
+            std::size_t position = hash & (capacity - 1);
+            while (m_slots[position].index != N)
+            {
+                const slot& s = m_slots[position];
+                if (s.hash == hash && s.name == name)
+                {
+                    return s.index;
+                }
+
+                position = (position + 1) & (capacity - 1);
+            }
+
+            return N;
+        }
+
+        /**********************************************************/
+        template <std::size_t N>
+        constexpr std::size_t name_index<N>::size()
+        {
+            return N;
+        }
+
+    } // namespace detail
+} // namespace reflect
\ No newline at end of file
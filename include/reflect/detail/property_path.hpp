@@ -0,0 +1,242 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_DETAIL_PROPERTY_PATH_HPP_
+#define _REFLECT_DETAIL_PROPERTY_PATH_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef>     // Positions of the properties along a path.
+#include <string>      // Storing the dotted names of the paths.
+#include <tuple>       // Collecting the paths of a class.
+#include <type_traits> // Selecting how each level of a path is set.
+#include <utility>     // Index sequences and forwarding.
+
+//====================
+// Reflect includes
+//====================
+#include "../string_view.hpp" // Naming the paths.
+#include "accessors.hpp"      // Detecting levels bound to member variables.
+#include "name_index.hpp"     // Looking up paths by their dotted names.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Aliases
+        //====================
+        /** Alias for the type of the registered property at a position within a class. */
+        template <typename Class, std::size_t I>
+        using property_at = std::decay_t<std::tuple_element_t<I, std::decay_t<decltype(register_class<Class>())>>>;
+
+        /** Alias for the member type of the registered property at a position within a class. */
+        template <typename Class, std::size_t I>
+        using member_type_at = typename property_at<Class, I>::member_type;
+
+        //====================
+        // Structs
+        //====================
+        /**
+         * Walks a chain of registered properties, each given by its position within the class of the previous level.
+         *
+         * This is the end of the chain, where the value itself has been reached.
+         */
+        template <typename T, std::size_t... Chain>
+        struct path_access
+        {
+            /** The type of the value at the end of the chain. */
+            using leaf_type = T;
+
+            /** @brief Appends nothing, as there are no more names along the chain. */
+            static void append_name(std::string& name);
+
+            /** @brief Invokes the function with the value at the end of the chain. */
+            template <typename F>
+            static decltype(auto) visit(const T& value, F&& f);
+
+            /** @returns True, as there are no more levels to check. */
+            static bool has_member();
+            /** @returns True, as there are no more levels to check. */
+            static bool is_settable();
+        };
+
+        /** Walks a chain of registered properties, each given by its position within the class of the previous level. */
+        template <typename T, std::size_t I, std::size_t... Rest>
+        struct path_access<T, I, Rest...>
+        {
+            /** The registered property of this level. */
+            using property_type = property_at<T, I>;
+            /** The type of the value at the end of the chain. */
+            using leaf_type = typename path_access<typename property_type::member_type, Rest...>::leaf_type;
+
+            /** @returns The registered property of this level. */
+            static const property_type& property();
+
+            /** @returns The registered property at the end of the chain. */
+            static const auto& leaf();
+            /** @returns The registered property of this level, which is the last along the chain. */
+            static const auto& leaf(std::true_type);
+            /** @returns The registered property at the end of the rest of the chain. */
+            static const auto& leaf(std::false_type);
+
+            /** @brief Appends the name of each property along the chain, separated by dots. */
+            static void append_name(std::string& name);
+
+            /** @brief Invokes the function with the value at the end of the chain, visiting each level in place. */
+            template <typename F>
+            static decltype(auto) visit(const T& object, F&& f);
+
+            /**
+             * @brief Sets the value at the end of the chain.
+             *
+             * Levels bound to member variables are modified in place. Levels bound to getters and setters are
+             * copied, modified and then set back through their setter.
+             */
+            template <typename V>
+            static void set(T& object, V&& value);
+
+            /** @brief Sets the value at the end of the chain, where this is the last level. */
+            template <typename V>
+            static void set_level(T& object, V&& value, std::true_type, std::true_type);
+
+            /** @brief Sets the value at the end of the chain through the referenced member variable of this level. */
+            template <typename V>
+            static void set_level(T& object, V&& value, std::false_type, std::true_type);
+
+            /** @brief Sets the value at the end of the chain through a copy of this level, which is then set back. */
+            template <typename V>
+            static void set_level(T& object, V&& value, std::false_type, std::false_type);
+
+            /** @returns True if every level along the chain is bound to a member variable. */
+            static bool has_member();
+            /** @returns True if every level along the chain has a setter or is bound to a member variable. */
+            static bool is_settable();
+        };
+
+        /**
+         * A property bound to a dotted path through nested registered classes, such as "position.x".
+         *
+         * The path is resolved into the positions of its properties at compile time, so getting or setting
+         * the value is a chain of direct accesses, with no names looked up. It offers the same interface as
+         * a registered property, so it can be dispatched to and bound to member handles in the same way. When the
+         * path ends at an enum property, its names are converted through that property.
+         */
+        template <typename Class, std::size_t... Chain>
+        class property_path final
+        {
+        private:
+            //====================
+            // Aliases
+            //====================
+            using access = path_access<Class, Chain...>;
+
+        public:
+            using class_type = Class;
+            using member_type = typename access::leaf_type;
+
+            //====================
+            // Getters and setters
+            //====================
+            /** @returns The dotted name of the path, which is built once. */
+            string_view get_name() const;
+
+            /** @returns The position of the top-level property that the path descends from. */
+            static constexpr std::size_t get_root();
+
+            /** @returns A copy of the value at the end of the path. */
+            member_type get_copy(const Class& obj) const;
+
+            /** @returns The registered name of an enum value, through the enum property at the end of the path. */
+            string_view to_string(member_type value) const;
+
+            /** @returns The enum value registered with the name, through the enum property at the end of the path. */
+            member_type from_string(string_view name) const;
+
+            /** @brief Invokes the function with a constant reference to the value at the end of the path. */
+            template <typename F>
+            decltype(auto) visit(const Class& obj, F&& f) const;
+
+            /**
+             * @brief Sets the value at the end of the path.
+             *
+             * @throws meta_exception If a property along the path has no setter or member pointer.
+             */
+            template <typename V, typename = std::enable_if_t<std::is_constructible<member_type, V>::value>>
+            void set(Class& obj, V&& value) const;
+
+            /** @returns True if every property along the path is bound to a member variable. */
+            bool has_member() const;
+            /** @returns True if every property along the path can be set, which is checked alongside has_member. */
+            bool has_setter() const;
+        };
+
+        /** Collects the paths of every property nested below a property, which is not a registered class. */
+        template <typename Class, typename T, typename Chain, typename = void>
+        struct path_tree
+        {
+            using type = std::tuple<>;
+        };
+
+        /** Collects the paths of every property nested below a registered class, in depth-first order. */
+        template <typename Class, typename T, std::size_t... Chain>
+        struct path_tree<Class, T, std::index_sequence<Chain...>, std::enable_if_t<is_registered<T>()>>
+        {
+            /** The path to the property at a position within the class, followed by the paths nested below it. */
+            template <std::size_t I>
+            using subtree = decltype(std::tuple_cat(std::declval<std::tuple<property_path<Class, Chain..., I>>>(),
+                std::declval<typename path_tree<Class, member_type_at<T, I>, std::index_sequence<Chain..., I>>::type>()));
+
+            template <std::size_t... I>
+            static auto expand(std::index_sequence<I...>) -> decltype(std::tuple_cat(std::declval<subtree<I>>()...));
+
+            using type = decltype(expand(std::make_index_sequence<std::tuple_size<std::decay_t<decltype(register_class<T>())>>::value>()));
+        };
+
+        /** Stores the paths to every property nested within the registered properties of a class. */
+        template <typename Class>
+        struct nested_paths final
+        {
+            template <std::size_t... I>
+            static auto expand(std::index_sequence<I...>) -> decltype(std::tuple_cat(
+                std::declval<typename path_tree<Class, member_type_at<Class, I>, std::index_sequence<I>>::type>()...));
+
+            /** A tuple containing a path for each nested property. */
+            using type = decltype(expand(std::make_index_sequence<std::tuple_size<std::decay_t<decltype(register_class<Class>())>>::value>()));
+
+            /** @returns The paths to each nested property, such as "position.x". */
+            static const type& paths();
+
+            /** @returns The index of the dotted names of the paths, which is built once. */
+            static const name_index<std::tuple_size<type>::value>& index();
+        };
+
+    } // namespace detail
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "property_path.inl" // Method declarations.
+
+#endif//_REFLECT_DETAIL_PROPERTY_PATH_HPP_
\ No newline at end of file
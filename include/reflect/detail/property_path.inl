@@ -0,0 +1,262 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+namespace reflect
+{
+    namespace detail
+    {
+        //========================================
+        // path_access
+        //========================================
+        /**********************************************************/
+        template <typename T, std::size_t... Chain>
+        void path_access<T, Chain...>::append_name(std::string&)
+        {
+            // Empty.
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t... Chain>
+        template <typename F>
+        decltype(auto) path_access<T, Chain...>::visit(const T& value, F&& f)
+        {
+            return f(value);
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t... Chain>
+        bool path_access<T, Chain...>::has_member()
+        {
+            return true;
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t... Chain>
+        bool path_access<T, Chain...>::is_settable()
+        {
+            return true;
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t I, std::size_t... Rest>
+        auto path_access<T, I, Rest...>::property() -> const property_type&
+        {
+            return std::get<I>(get_members<T>());
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t I, std::size_t... Rest>
+        const auto& path_access<T, I, Rest...>::leaf()
+        {
+            return leaf(std::integral_constant<bool, sizeof...(Rest) == 0>());
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t I, std::size_t... Rest>
+        const auto& path_access<T, I, Rest...>::leaf(std::true_type)
+        {
+            return property();
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t I, std::size_t... Rest>
+        const auto& path_access<T, I, Rest...>::leaf(std::false_type)
+        {
+            return path_access<typename property_type::member_type, Rest...>::leaf();
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t I, std::size_t... Rest>
+        void path_access<T, I, Rest...>::append_name(std::string& name)
+        {
+            const string_view level = property().get_name();
+            if (!name.empty())
+            {
+                name.push_back('.');
+            }
+
+            name.append(level.data(), level.size());
+            path_access<typename property_type::member_type, Rest...>::append_name(name);
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t I, std::size_t... Rest>
+        template <typename F>
+        decltype(auto) path_access<T, I, Rest...>::visit(const T& object, F&& f)
+        {
+            return property().visit(object, [&f](const auto& nested) -> decltype(auto) {
+                return path_access<typename property_type::member_type, Rest...>::visit(nested, f);
+            });
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t I, std::size_t... Rest>
+        template <typename V>
+        void path_access<T, I, Rest...>::set(T& object, V&& value)
+        {
+            set_level(object, std::forward<V>(value), std::integral_constant<bool, sizeof...(Rest) == 0>(),
+                std::integral_constant<bool, sizeof...(Rest) == 0 || is_member_accessor<typename property_type::accessor_type>::value>());
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t I, std::size_t... Rest>
+        template <typename V>
+        void path_access<T, I, Rest...>::set_level(T& object, V&& value, std::true_type, std::true_type)
+        {
+            property().set(object, std::forward<V>(value));
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t I, std::size_t... Rest>
+        template <typename V>
+        void path_access<T, I, Rest...>::set_level(T& object, V&& value, std::false_type, std::true_type)
+        {
+            path_access<typename property_type::member_type, Rest...>::set(property().get_reference(object), std::forward<V>(value));
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t I, std::size_t... Rest>
+        template <typename V>
+        void path_access<T, I, Rest...>::set_level(T& object, V&& value, std::false_type, std::false_type)
+        {
+            typename property_type::member_type nested = property().get_copy(object);
+            path_access<typename property_type::member_type, Rest...>::set(nested, std::forward<V>(value));
+            property().set(object, std::move(nested));
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t I, std::size_t... Rest>
+        bool path_access<T, I, Rest...>::has_member()
+        {
+            return property().has_member() && path_access<typename property_type::member_type, Rest...>::has_member();
+        }
+
+        /**********************************************************/
+        template <typename T, std::size_t I, std::size_t... Rest>
+        bool path_access<T, I, Rest...>::is_settable()
+        {
+            return (property().has_setter() || property().has_member()) && path_access<typename property_type::member_type, Rest...>::is_settable();
+        }
+
+        //========================================
+        // property_path
+        //========================================
+        /**********************************************************/
+        template <typename Class, std::size_t... Chain>
+        constexpr std::size_t property_path<Class, Chain...>::get_root()
+        {
+            constexpr std::size_t chain[] = { Chain... };
+            return chain[0];
+        }
+
+        /**********************************************************/
+        template <typename Class, std::size_t... Chain>
+        string_view property_path<Class, Chain...>::get_name() const
+        {
+            static const std::string name = [] {
+                std::string result;
+                access::append_name(result);
+                return result;
+            }();
+
+            return string_view(name);
+        }
+
+        /**********************************************************/
+        template <typename Class, std::size_t... Chain>
+        auto property_path<Class, Chain...>::get_copy(const Class& obj) const -> member_type
+        {
+            return access::visit(obj, [](const member_type& value) -> member_type {
+                return value;
+            });
+        }
+
+        /**********************************************************/
+        template <typename Class, std::size_t... Chain>
+        string_view property_path<Class, Chain...>::to_string(member_type value) const
+        {
+            return access::leaf().to_string(value);
+        }
+
+        /**********************************************************/
+        template <typename Class, std::size_t... Chain>
+        auto property_path<Class, Chain...>::from_string(string_view name) const -> member_type
+        {
+            return access::leaf().from_string(name);
+        }
+
+        /**********************************************************/
+        template <typename Class, std::size_t... Chain>
+        template <typename F>
+        decltype(auto) property_path<Class, Chain...>::visit(const Class& obj, F&& f) const
+        {
+            return access::visit(obj, f);
+        }
+
+        /**********************************************************/
+        template <typename Class, std::size_t... Chain>
+        template <typename V, typename>
+        void property_path<Class, Chain...>::set(Class& obj, V&& value) const
+        {
+            if (!access::is_settable())
+            {
+                throw meta_exception("Cannot set value: no setters or member pointer set.");
+            }
+
+            access::set(obj, std::forward<V>(value));
+        }
+
+        /**********************************************************/
+        template <typename Class, std::size_t... Chain>
+        bool property_path<Class, Chain...>::has_member() const
+        {
+            return access::has_member();
+        }
+
+        /**********************************************************/
+        template <typename Class, std::size_t... Chain>
+        bool property_path<Class, Chain...>::has_setter() const
+        {
+            return access::is_settable();
+        }
+
+        //========================================
+        // nested_paths
+        //========================================
+        /**********************************************************/
+        template <typename Class>
+        auto nested_paths<Class>::paths() -> const type&
+        {
+            static const type paths = type();
+            return paths;
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        auto nested_paths<Class>::index() -> const name_index<std::tuple_size<type>::value>&
+        {
+            static const name_index<std::tuple_size<type>::value> names(paths());
+            return names;
+        }
+
+    } // namespace detail
+} // namespace reflect
\ No newline at end of file
@@ -23,6 +23,19 @@
 #ifndef _REFLECT_DETAIL_HELPERS_HPP_
 #define _REFLECT_DETAIL_HELPERS_HPP_
 
+//====================
+// C++ includes
+//====================
+#include <cstddef>     // Indexing into tuples.
+#include <tuple>       // Iterating over tuples.
+#include <type_traits> // Enabling templates.
+#include <utility>     // Index sequences and forwarding.
+
+//====================
+// Reflect includes
+//====================
+#include "meta_exception.hpp" // Throwing meta exceptions.
+
 namespace reflect 
 {
     namespace detail 
@@ -60,6 +73,41 @@ namespace reflect
         template <typename F>
         void for_tuple(F&& f, const std::tuple<>& tuple);
 
+        /**
+         * @brief Invokes the given function with a single element of the specified tuple object.
+         *
+         * The element is selected at runtime through a table of function pointers, with one entry
+         * generated for each element of the tuple, rather than iterating the tuple until a match is found.
+         * The index must be less than the size of the tuple.
+         *
+         * @tparam R    The type returned by the function for every element.
+         * @param index The position of the element within the tuple.
+         * @param f     The function to invoke.
+         * @param tuple The tuple containing the element.
+         *
+         * @returns The result of the invoked function.
+         */
+        template <typename R, typename F, typename T>
+        R for_tuple_at(std::size_t index, F&& f, T&& tuple);
+
+        /**
+         * @brief Invokes the given function with a single element of the specified tuple object.
+         *
+         * This function is only created to satisfy the condition if a single empty
+         * tuple is supplied. As the tuple has no elements, any index is out of range.
+         *
+         * @tparam R    The type returned by the function for every element.
+         * @param index The position of the element within the tuple.
+         * @param f     The function to invoke.
+         * @param tuple The tuple containing the element.
+         *
+         * @returns Nothing.
+         *
+         * @throws meta_exception As the tuple is empty.
+         */
+        template <typename R, typename F>
+        R for_tuple_at(std::size_t index, F&& f, const std::tuple<>& tuple);
+
         /**
          * @brief Calls the specified function with the arguments if the enable condition is true.
          * 
@@ -75,11 +75,43 @@ namespace reflect
 
         /**********************************************************/
         template <typename F>
-        void for_tuple(F&& f, const std::tuple<>& tuple)
+        void for_tuple(F&&, const std::tuple<>&)
         {
             // Empty.
         }
 
+        /**********************************************************/
+        template <typename R, std::size_t I, typename F, typename Tuple>
+        R invoke_at(F& f, Tuple& tuple)
+        {
+            return f(std::get<I>(tuple));
+        }
+
+        /**********************************************************/
+        template <typename R, typename F, typename Tuple, size_t... I>
+        R for_tuple_at_impl(std::size_t index, F& f, Tuple& tuple, std::index_sequence<I...>)
+        {
+            using func_type = R(*)(F&, Tuple&);
+
+            static constexpr func_type table[] = { &invoke_at<R, I, F, Tuple>... };
+            return table[index](f, tuple);
+        }
+
+        /**********************************************************/
+        template <typename R, typename F, typename T>
+        R for_tuple_at(std::size_t index, F&& f, T&& tuple)
+        {
+            constexpr size_t size = std::tuple_size<std::decay_t<T>>::value;
+            return for_tuple_at_impl<R>(index, f, tuple, std::make_index_sequence<size>());
+        }
+
+        /**********************************************************/
+        template <typename R, typename F>
+        R for_tuple_at(std::size_t, F&&, const std::tuple<>&)
+        {
+            throw meta_exception("Cannot access an element of an empty tuple.");
+        }
+
         /**********************************************************/
         template <bool Test, typename F, typename... Args, typename>
         void call_if(F&& f, Args&&... args)
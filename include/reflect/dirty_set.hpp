@@ -0,0 +1,149 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_DIRTY_SET_HPP_
+#define _REFLECT_DIRTY_SET_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef> // Positions of the properties.
+#include <cstdint> // Storing the bits as words.
+#include <tuple>   // Counting the registered properties.
+
+//====================
+// Reflect includes
+//====================
+#include "string_view.hpp" // Marking properties by name.
+#include "meta_class.hpp"  // Locating the registered properties.
+
+namespace reflect
+{
+    template <typename Class>
+    class dirty_set final
+    {
+    public:
+        //====================
+        // Member variables
+        //====================
+        /** The number of registered properties, and so the number of bits. */
+        static constexpr std::size_t property_count = std::tuple_size<std::decay_t<decltype(register_class<Class>())>>::value;
+
+    private:
+        /** The number of words holding the bits, of which there is always at least one. */
+        static constexpr std::size_t word_count = property_count / 64 + 1;
+
+        //====================
+        // Member variables
+        //====================
+        /** A bit for each registered property, indexed by its position in registration order. */
+        std::uint64_t m_words[word_count];
+
+    public:
+        //====================
+        // Ctors and dtor
+        //====================
+        /**
+         * @brief Constructor for creating a set with no dirty properties.
+         */
+        dirty_set();
+
+        /**
+         * @brief Default destructor.
+         */
+        ~dirty_set() = default;
+
+        //====================
+        // Getters and setters
+        //====================
+        /**
+         * @brief Checks whether the property at the position has been marked.
+         *
+         * @param position The position of the property in registration order.
+         *
+         * @returns True if the property is dirty.
+         */
+        bool is_dirty(std::size_t position) const;
+
+        /**
+         * @brief Checks whether any property has been marked.
+         *
+         * @returns True if at least one property is dirty.
+         */
+        bool any() const;
+
+        /**
+         * @brief Retrieves the number of marked properties.
+         *
+         * @returns The number of dirty properties.
+         */
+        std::size_t count() const;
+
+        /**
+         * @brief Finds the first marked property at or after the position.
+         *
+         * Words without any marked properties are skipped whole, so iterating the few dirty properties of
+         * a large class does not test every bit.
+         *
+         * @param position The position to start searching from.
+         *
+         * @returns The position of the next dirty property, or property_count if there is none.
+         */
+        std::size_t find_next(std::size_t position) const;
+
+        //====================
+        // Methods
+        //====================
+        /**
+         * @brief Marks the property at the position as dirty.
+         *
+         * @param position The position of the property in registration order.
+         */
+        void mark(std::size_t position);
+
+        /**
+         * @brief Marks the named property as dirty.
+         *
+         * Names registered with the class are marked directly, even if they contain a '.'. Otherwise a
+         * dotted path marks the top-level property it descends from, so that the whole nested value is
+         * written out again.
+         *
+         * @param name The name of the property, or a dotted path to a nested member.
+         *
+         * @returns True if a property with the name is registered.
+         */
+        bool mark(string_view name);
+
+        /**
+         * @brief Marks every property as clean.
+         */
+        void clear();
+    };
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "dirty_set.inl" // Method declarations.
+
+#endif//_REFLECT_DIRTY_SET_HPP_
\ No newline at end of file
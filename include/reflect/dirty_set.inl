@@ -0,0 +1,150 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+namespace reflect
+{
+    //====================
+    // Ctors and dtor
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    dirty_set<Class>::dirty_set()
+        : m_words()
+    {
+        // Empty.
+    }
+
+    //====================
+    // Getters and setters
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    bool dirty_set<Class>::is_dirty(std::size_t position) const
+    {
+        return (m_words[position / 64] >> (position % 64)) & 1;
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    bool dirty_set<Class>::any() const
+    {
+        for (std::uint64_t word : m_words)
+        {
+            if (word != 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    std::size_t dirty_set<Class>::count() const
+    {
+        std::size_t count = 0;
+        for (std::uint64_t word : m_words)
+        {
+            for (; word != 0; word &= word - 1)
+            {
+                ++count;
+            }
+        }
+
+        return count;
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    std::size_t dirty_set<Class>::find_next(std::size_t position) const
+    {
+        while (position < property_count)
+        {
+            std::uint64_t word = m_words[position / 64] >> (position % 64);
+            if (word == 0)
+            {
+                position = (position / 64 + 1) * 64;
+                continue;
+            }
+
+            for (; (word & 1) == 0; word >>= 1)
+            {
+                ++position;
+            }
+
+            return position;
+        }
+
+        return property_count;
+    }
+
+    //====================
+    // Methods
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    void dirty_set<Class>::mark(std::size_t position)
+    {
+        m_words[position / 64] |= std::uint64_t(1) << (position % 64);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    bool dirty_set<Class>::mark(string_view name)
+    {
+        const auto& index = detail::metadata_t<Class, decltype(register_class<Class>())>::index();
+
+        const std::size_t position = index.find(name);
+        if (position != index.size())
+        {
+            this->mark(position);
+            return true;
+        }
+
+        // A dotted path marks the top-level property it descends from.
+        const auto& path_index = detail::nested_paths<Class>::index();
+
+        const std::size_t path_position = path_index.find(name);
+        if (path_position == path_index.size())
+        {
+            return false;
+        }
+
+        detail::for_tuple_at<void>(path_position, [this](const auto& path) {
+            this->mark(path.get_root());
+        }, detail::nested_paths<Class>::paths());
+
+        return true;
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    void dirty_set<Class>::clear()
+    {
+        for (std::uint64_t& word : m_words)
+        {
+            word = 0;
+        }
+    }
+
+} // namespace reflect
\ No newline at end of file
@@ -26,106 +26,49 @@
 //====================
 // C++ includes
 //====================
-#include <unordered_map> // Storing string representations of enums.
+#include <cstddef>     // Number of registered enum values.
+#include <stdexcept>   // Throwing when a value has not been registered.
+#include <type_traits> // Enabling the properties for enumerations.
 
 //====================
 // Reflect includes
 //====================
-#include "property.hpp"  // enum property is a type of property.
+#include "property.hpp"          // enum property is a type of property.
+#include "detail/enum_table.hpp" // Storing string representations of enums.
 
 namespace reflect
 {
-    //====================
-    // Structs
-    //====================
-    template <typename T>
-    struct enum_property_hash
-    {
-        /**
-         * @brief Simple hashing method that will hash enums to a registered string.
-         * 
-         * @param value The enum value to generate a hash for.
-         * 
-         * @returns The unique hash of the enum.
-         */
-        template <typename = std::enable_if_t<std::is_enum<T>::value>>
-        std::size_t operator()(T const& value) const;
-    };
-
-    template <typename, typename>
-    class empty_map
+    template <typename Class, typename T, typename Accessor = detail::dynamic_accessor<Class, T>, std::size_t N = 0>
+    class enum_property_impl final : public property_impl<Class, T, Accessor>
     {
-        // Empty.
-    };
+        static_assert(std::is_enum<T>::value, "An enum property must be bound to an enumerated type.");
 
-    //====================
-    // Aliases
-    //====================
-    /** Alias for a map that uses enums as the key with their mapped string values. */
-    template <typename T>
-    using to_string_map_type = std::unordered_map<T, std::string, enum_property_hash<T>>;
-
-    /** Alias for a map that uses string as the key with their mapped enum values. */
-    template <typename T>
-    using from_string_map_type = std::unordered_map<std::string, T>;
+        // Properties with fewer values are needed to register another value.
+        template <typename, typename, typename, std::size_t>
+        friend class enum_property_impl;
 
-    template <typename Class, typename T>
-    class enum_property_impl final : public property_impl<Class, T>
-    {
     private:
         //====================
-        // Private methods
+        // Member variables
         //====================
-        /**
-         * @brief Errorneous method that is invoked if the template argument is not an enumerated type.
-         * 
-         * @returns An empty map containing no enum property information.
-         */
-        template <typename U = T>
-        typename std::enable_if<!std::is_enum<U>::value, empty_map<U, U>>::type to_string_map() const;
-
-        /**
-         * @brief Creates a static map containing information on how enum types are mapped to strings. 
-         * 
-         * When this method is invoked, it will lazily load a map to store the conversions from enum types to
-         * their respective string representations.
-         * 
-         * @returns The lazily loaded enum to string map.
-         */
-        template <typename U = T>
-        typename std::enable_if<std::is_enum<U>::value, to_string_map_type<U>&>::type to_string_map() const;
-
-        /**
-         * @brief Errorneous method that is invoked if the template argument is not an enumerated type.
-         * 
-         * @returns An empty map containing no enum property information.
-         */
-        template <typename U = T>
-        typename std::enable_if<!std::is_enum<U>::value, empty_map<U, U>>::type from_string_map() const;
-
-        /**
-         * @brief Creates a static map containing information on how strings are mapped to enum types. 
-         * 
-         * When this method is invoked, it will lazily load a map to store the conversions from strings to their
-         * respective enum types.
-         * 
-         * @returns The lazily loaded string to enum map.
-         */
-        template <typename U = T>
-        typename std::enable_if<std::is_enum<U>::value, from_string_map_type<U>&>::type from_string_map() const;
+        /** The names registered to each enum value of this property. */
+        detail::enum_table<T, N> m_table;
 
+        //====================
+        // Ctors and dtor
+        //====================
         /**
-         * @brief Errorneous method that is invoked if the template argument is not an enumerated type.
-         * 
-         * If a value is appended to the property which is not an enumerated type, an exception will be thrown to 
-         * prevent this undefined behavior.
-         * 
-         * @returns Nothing.
-         * 
-         * @throws meta_exception As an incorrect type has been passed to the method.
+         * @brief Constructor for registering another enum value with an existing property.
+         *
+         * The size of the previous property is deduced, so that the constructor is never mistaken for
+         * the public constructor when the accessors are converted.
+         *
+         * @param property The property containing the previously registered values.
+         * @param name     The name of the enum value.
+         * @param value    The enum value.
          */
-        template <typename U = T>
-        typename std::enable_if<!std::is_enum<U>::value, enum_property_impl<Class, T>&>::type set_value(const std::string& name, T value);
+        template <std::size_t M, typename = std::enable_if_t<M + 1 == N>>
+        constexpr explicit enum_property_impl(const enum_property_impl<Class, T, Accessor, M>& property, string_view name, T value);
 
     public:
         //====================
@@ -140,51 +83,17 @@ namespace reflect
         explicit enum_property_impl() = delete;
         
         /**
-         * @brief Constructor for creating a new enum_property_impl object with a member variable functor.
-         * 
-         * When this constructor is invoked, it will create a new enum_property_impl object that binds the member
-         * variable of a class for getting and setting when invoked by the meta engine.
-         * 
-         * @param name   The name of the property when serialized.
-         * @param member The member variable to bind to the property.
-         */
-        explicit enum_property_impl(const std::string& name, member_ptr<Class, T> member);
-
-        /**
-         * @brief Constructor for creating a new enum_property_impl object with a getter and setter which uses referenced values.
-         * 
-         * When this constructor is invoked, it will create a new enum_property_impl object that binds the getter and
-         * setter of a class that utilises return values and arguments that are referred to by reference.
-         * 
-         * @param name   The name of the property when serialized.
-         * @param getter The getter function to bind.
-         * @param setter The setter function to bind.
-         */
-        explicit enum_property_impl(const std::string& name, ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
-
-        /**
-         * @brief Constructor for creating a new enum_property_impl object with a getter and setter which uses object values.
-         * 
-         * When this constructor is invoked, it will create a new enum_property_impl object that binds the getter and
-         * setter of a class that utilises return values and arguments that are referred to by reference.
-         * 
-         * @param name   The name of the property when serialized.
-         * @param getter The getter function to bind.
-         * @param setter The setter function to bind.
-         */
-        explicit enum_property_impl(const std::string& name, val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter);
-
-        /**
-         * @brief Constructor for creating a new enum_property_impl object with a getter and setter which uses referenced or object values.
+         * @brief Constructor for creating a new enum_property_impl object.
          * 
-         * When this constructor is invoked, it will create a new enum_property_impl object that binds the getter and
-         * setter of a class that utilises return values and arguments that are either referenced of by value.
+         * When this constructor is invoked, the member variable pointer, or the getter and setter
+         * function pointers, are passed to the accessor to bind the property to the class for getting
+         * and setting when invoked by the meta engine. The property starts with no registered values.
          * 
-         * @param name   The name of the property when serialized.
-         * @param getter The getter function to bind.
-         * @param setter The setter function to bind.
+         * @param name      The name of the property when serialized.
+         * @param accessors The member variable or getter and setter functions to bind to the property.
          */
-        explicit enum_property_impl(const std::string& name, val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
+        template <typename... Ptrs>
+        constexpr explicit enum_property_impl(string_view name, Ptrs... accessors);
 
         /**
          * @brief Default destructor for the propert_impl object.
@@ -199,54 +108,42 @@ namespace reflect
          * 
          * When a enum_property is registered with the meta engine, the values of the enum must also be registered
          * so that the value can be changed either through a variable or the defined string. The strings are added to
-         * provide extra information if the class is serialized by a external library. The method will only be invoked
-         * if the value passed in is a enumerated type.
+         * provide extra information if the class is serialized by a external library. The property is not modified,
+         * instead a new property is returned with the value added to its lookup tables, so that the tables can be
+         * built at compile time.
          * 
          * @param name  The string literal name of the enum type.
          * @param value The enum variable.
          * 
-         * @returns A reference to itself, so that setting values can be chained.
+         * @returns A copy of the property with the value registered, so that setting values can be chained.
+         */
+        constexpr enum_property_impl<Class, T, Accessor, N + 1> set_value(string_view name, T value) const;
+
+        /**
+         * @brief Deleted overload that rejects temporary strings as enum value names, which are viewed rather than copied.
          */
-        template <typename U = T>
-        typename std::enable_if<std::is_enum<U>::value, enum_property_impl<Class, T>&>::type set_value(const std::string& name, T value);
+        template <typename S, typename = std::enable_if_t<std::is_same<S, std::string>::value>>
+        void set_value(S&& name, T value) const = delete;
 
         /**
          * @brief Converts the specified enum value to its mapped string value.
          * 
          * When this method is invoked, it will retrieve the mapped string equivalent of the enumerated
          * type within the property. If the value has not been registered, an out of range exception is thrown.
-         * This method is only invoked if the value passed in is a enumerated type.
          * 
          * @param value The enumerated value to convert to a string.
          * 
-         * @returns A string representation of the enum variable.
+         * @returns A view of the registered name of the enum variable.
          * 
          * @throws out_of_range exception If the enum value has not been registered with the property.
          */
-        template <typename U = T>
-        typename std::enable_if<std::is_enum<U>::value, std::string&>::type to_string(const T value) const;
+        string_view to_string(const T value) const;
 
-        /**
-         * @brief Errorneous method for retrieving a string from a non enumerated type.
-         * 
-         * This method is only invoked if the value passed in is not a enumeration. An exception will be thrown
-         * upon use of this method.
-         * 
-         * @param The non-enumerated value.
-         * 
-         * @returns Nothing.
-         * 
-         * @throws meta_exception is the method is invoked. 
-         */
-        template <typename U = T>
-        typename std::enable_if<!std::is_enum<U>::value, std::string&>::type to_string(const T value) const;
-        
         /**
          * @brief Converts the specified string to its mapped enum value.
          * 
          * When this method is invoked, it will retrieve the mapped enum equivalent of the specified string
          * within the property. If the value has not been registered, an out of range exception is thrown.
-         * This method is only invoked if the value passed in is a enumerated type.
          * 
          * @param name The string to convert to a enumerated type.
          * 
@@ -254,25 +151,24 @@ namespace reflect
          * 
          * @throws out_of_range exception If the string value has not been registered with the property.
          */
-        template <typename U = T>
-        typename std::enable_if<std::is_enum<U>::value, U>::type from_string(const std::string& name) const;
-
-        /**
-         * @brief Errorneous method for retrieving a enum from a non registered data-type.
-         * 
-         * This method is only invoked if the template argument is not a enumeration. An exception will be thrown
-         * upon use of this method.
-         * 
-         * @param The name of the enum.
-         * 
-         * @returns Nothing.
-         * 
-         * @throws meta_exception is the method is invoked. 
-         */
-        template <typename U = T>
-        typename std::enable_if<!std::is_enum<U>::value, U>::type from_string(const std::string& name) const;
+        T from_string(string_view name) const;
     };
 
+    namespace detail
+    {
+        //====================
+        // Structs
+        //====================
+        /** Checks whether the property maps its enum values to registered names. */
+        template <typename Property>
+        struct is_enum_property : std::false_type {};
+
+        /** Checks whether the property maps its enum values to registered names. */
+        template <typename Class, typename T, typename Accessor, std::size_t N>
+        struct is_enum_property<enum_property_impl<Class, T, Accessor, N>> : std::true_type {};
+
+    } // namespace detail
+
     //====================
     // Functions
     //====================
@@ -289,7 +185,7 @@ namespace reflect
      * @returns A new enum_property_impl object with a bound member variable functor.
      */
     template <typename Class, typename T, typename = std::enable_if_t<std::is_enum<T>::value>>
-    enum_property_impl<Class, T> enum_property(const std::string& name, member_ptr<Class, T> member);
+    constexpr enum_property_impl<Class, T, detail::member_accessor<Class, T>> enum_property(string_view name, member_ptr<Class, T> member);
 
     /**
     * @brief Convenience method for creating a new enum_property_impl object with reference getter.
@@ -308,7 +204,7 @@ namespace reflect
     * @throws runtime_error If the property is attempting to set the value.
     */
     template <typename Class, typename T, typename = std::enable_if_t<std::is_enum<T>::value>>
-    enum_property_impl<Class, T> enum_property(const std::string& name, ref_getter_func_ptr<Class, T> getter);
+    constexpr enum_property_impl<Class, T, detail::readonly_accessor<Class, T, ref_getter_func_ptr<Class, T>>> enum_property(string_view name, ref_getter_func_ptr<Class, T> getter);
 
     /**
     * @brief Convenience method for creating a new enum_property_impl object with by value getter.
@@ -327,7 +223,7 @@ namespace reflect
     * @throws runtime_error If the property is attempting to set the value.
     */
     template <typename Class, typename T, typename = std::enable_if_t<std::is_enum<T>::value>>
-    enum_property_impl<Class, T> enum_property(const std::string& name, val_getter_func_ptr<Class, T> getter);
+    constexpr enum_property_impl<Class, T, detail::readonly_accessor<Class, T, val_getter_func_ptr<Class, T>>> enum_property(string_view name, val_getter_func_ptr<Class, T> getter);
 
     /**
      * @brief Convenience method for creating a new enum_property_impl object with reference getters and setters.
@@ -343,7 +239,7 @@ namespace reflect
      * @returns A new enum_property_impl object with a bound referenced getter and setter functors.
      */
     template <typename Class, typename T, typename = std::enable_if_t<std::is_enum<T>::value>>
-    enum_property_impl<Class, T> enum_property(const std::string& name, ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
+    constexpr enum_property_impl<Class, T, detail::function_accessor<Class, T, ref_getter_func_ptr<Class, T>, ref_setter_func_ptr<Class, T>>> enum_property(string_view name, ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
 
     /**
      * @brief Convenience method for creating a new enum_property_impl object with by value getters and setters.
@@ -359,7 +255,7 @@ namespace reflect
      * @returns A new enum_property_impl object with a bound value based getter and setter functors.
      */
     template <typename Class, typename T, typename = std::enable_if_t<std::is_enum<T>::value>>
-    enum_property_impl<Class, T> enum_property(const std::string& name, val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter);
+    constexpr enum_property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, val_setter_func_ptr<Class, T>>> enum_property(string_view name, val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter);
 
     /**
      * @brief Convenience method for creating a new enum_property_impl object with a value getter and a setter which takes a referenced parameter.
@@ -375,7 +271,13 @@ namespace reflect
      * @returns A new enum_property_impl object with a bound value-based getter and reference-based setter functors.
      */
     template <typename Class, typename T, typename = std::enable_if_t<std::is_enum<T>::value>>
-    enum_property_impl<Class, T> enum_property(const std::string& name, val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
+    constexpr enum_property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, ref_setter_func_ptr<Class, T>>> enum_property(string_view name, val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
+
+    /**
+     * @brief Deleted overload that rejects temporary strings as property names, which would be left dangling. See property().
+     */
+    template <typename S, typename... Args, typename = std::enable_if_t<std::is_same<S, std::string>::value>>
+    void enum_property(S&& name, Args&&... args) = delete;
 }
 
 //====================
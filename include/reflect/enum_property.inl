@@ -22,154 +22,61 @@
 
 namespace reflect
 {
-    //========================================
-    // enum_property_hash
-    //========================================
-    //====================
-    // Operators
-    //====================
-    /**********************************************************/
-    template <typename T>
-    template <typename>
-    std::size_t enum_property_hash<T>::operator()(T const& value) const
-    {
-        using type = typename std::underlying_type<T>::type;
-        const type val = static_cast<type>(value);
-
-        std::hash<type> hash;
-        return hash(val);
-    }
-
-    //========================================
-    // enum_property_impl
-    //========================================
     //====================
     // Ctors and dtor
     //====================
     /**********************************************************/
-    template <typename Class, typename T>
-    enum_property_impl<Class, T>::enum_property_impl(const std::string& name, member_ptr<Class, T> member)
-        : property_impl<Class, T>(name, member)
-    {
-        // Empty.
-    }
-
-    /**********************************************************/
-    template <typename Class, typename T>
-    enum_property_impl<Class, T>::enum_property_impl(const std::string& name, ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter)
-        : property_impl<Class, T>(name, getter, setter)
+    template <typename Class, typename T, typename Accessor, std::size_t N>
+    template <typename... Ptrs>
+    constexpr enum_property_impl<Class, T, Accessor, N>::enum_property_impl(string_view name, Ptrs... accessors)
+        : property_impl<Class, T, Accessor>(name, accessors...), m_table()
     {
         // Empty.
     }
 
     /**********************************************************/
-    template <typename Class, typename T>
-    enum_property_impl<Class, T>::enum_property_impl(const std::string& name, val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter)
-        : property_impl<Class, T>(name, getter, setter)
+    template <typename Class, typename T, typename Accessor, std::size_t N>
+    template <std::size_t M, typename>
+    constexpr enum_property_impl<Class, T, Accessor, N>::enum_property_impl(const enum_property_impl<Class, T, Accessor, M>& property, string_view name, T value)
+        : property_impl<Class, T, Accessor>(property), m_table(property.m_table, name, value)
     {
         // Empty.
     }
 
-    /**********************************************************/
-    template <typename Class, typename T>
-    enum_property_impl<Class, T>::enum_property_impl(const std::string& name, val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter)
-        : property_impl<Class, T>(name, getter, setter)
-    {
-        // Empty.
-    }
-
-    //====================
-    // Private methods
-    //====================
-    /**********************************************************/
-    template <typename Class, typename T>
-    template <typename U>
-    typename std::enable_if<!std::is_enum<U>::value, empty_map<U, U>>::type enum_property_impl<Class, T>::to_string_map() const
-    {
-        throw detail::meta_exception("Called to_string_map on a non-enumerated type.");
-    }
-
-    /**********************************************************/
-    template <typename Class, typename T>
-    template <typename U>
-    typename std::enable_if<std::is_enum<U>::value, to_string_map_type<U>&>::type enum_property_impl<Class, T>::to_string_map() const
-    {
-        static to_string_map_type<U> map;
-        return map;
-    }
-
-    /**********************************************************/
-    template <typename Class, typename T>
-    template <typename U>
-    typename std::enable_if<!std::is_enum<U>::value, empty_map<U, U>>::type enum_property_impl<Class, T>::from_string_map() const
-    {
-        throw detail::meta_exception("Called from_string_map on a non-enumerated type.");
-    }
-
-    /**********************************************************/
-    template <typename Class, typename T>
-    template <typename U>
-    typename std::enable_if<std::is_enum<U>::value, from_string_map_type<U>&>::type enum_property_impl<Class, T>::from_string_map() const
-    {
-        static from_string_map_type<U> map;
-        return map;
-    }
-
-    /**********************************************************/
-    template <typename Class, typename T>
-    template <typename U>
-    typename std::enable_if<!std::is_enum<U>::value, enum_property_impl<Class, T>&>::type enum_property_impl<Class, T>::set_value(const std::string& name, T value)
-    {
-        throw detail::meta_exception("Called value on a non-enumerated type.");
-    }
-
     //====================
     // Methods
     //====================
     /**********************************************************/
-    template <typename Class, typename T>
-    template <typename U>
-    typename std::enable_if<std::is_enum<U>::value, enum_property_impl<Class, T>&>::type enum_property_impl<Class, T>::set_value(const std::string& name, T value)
+    template <typename Class, typename T, typename Accessor, std::size_t N>
+    constexpr enum_property_impl<Class, T, Accessor, N + 1> enum_property_impl<Class, T, Accessor, N>::set_value(string_view name, T value) const
     {
-        auto& to_map = this->to_string_map();
-        auto& from_map = this->from_string_map();
-
-        to_map[value] = name;
-        from_map[name] = value;
-
-        return *this;
+        return enum_property_impl<Class, T, Accessor, N + 1>(*this, name, value);
     }
 
     /**********************************************************/
-    template <typename Class, typename T>
-    template <typename U>
-    typename std::enable_if<std::is_enum<U>::value, std::string&>::type enum_property_impl<Class, T>::to_string(const T value) const
+    template <typename Class, typename T, typename Accessor, std::size_t N>
+    string_view enum_property_impl<Class, T, Accessor, N>::to_string(const T value) const
     {
-        return this->to_string_map().at(value);
-    }
+        const detail::enum_entry<T>* entry = m_table.find_value(value);
+        if (entry == nullptr)
+        {
+            throw std::out_of_range("Enum value has not been registered with property: " + this->get_name().to_string());
+        }
 
-    /**********************************************************/
-    template <typename Class, typename T>
-    template <typename U>
-    typename std::enable_if<!std::is_enum<U>::value, std::string&>::type enum_property_impl<Class, T>::to_string(const T value) const
-    {
-        throw detail::meta_exception("Called to_string on non-enumerated property.");
+        return entry->name;
     }
 
     /**********************************************************/
-    template <typename Class, typename T>
-    template <typename U>
-    typename std::enable_if<std::is_enum<U>::value, U>::type enum_property_impl<Class, T>::from_string(const std::string& name) const
+    template <typename Class, typename T, typename Accessor, std::size_t N>
+    T enum_property_impl<Class, T, Accessor, N>::from_string(string_view name) const
     {
-        return this->from_string_map().at(name);
-    }
+        const detail::enum_entry<T>* entry = m_table.find_name(name);
+        if (entry == nullptr)
+        {
+            throw std::out_of_range("Enum name: " + name.to_string() + " has not been registered with property: " + this->get_name().to_string());
+        }
 
-    /**********************************************************/
-    template <typename Class, typename T>
-    template <typename U>
-    typename std::enable_if<!std::is_enum<U>::value, U>::type enum_property_impl<Class, T>::from_string(const std::string& name) const
-    {
-        throw detail::meta_exception("Called from_string on non-enumerated property.");
+        return entry->value;
     }
 
     //====================
@@ -177,44 +84,44 @@ namespace reflect
     //====================
     /**********************************************************/
     template <typename Class, typename T, typename>
-    enum_property_impl<Class, T> enum_property(const std::string& name, member_ptr<Class, T> member)
+    constexpr enum_property_impl<Class, T, detail::member_accessor<Class, T>> enum_property(string_view name, member_ptr<Class, T> member)
     {
-        return enum_property_impl<Class, T>(name, member);
+        return enum_property_impl<Class, T, detail::member_accessor<Class, T>>(name, member);
     }
 
     /**********************************************************/
     template <typename Class, typename T, typename>
-    enum_property_impl<Class, T> enum_property(const std::string& name, ref_getter_func_ptr<Class, T> getter)
+    constexpr enum_property_impl<Class, T, detail::readonly_accessor<Class, T, ref_getter_func_ptr<Class, T>>> enum_property(string_view name, ref_getter_func_ptr<Class, T> getter)
     {
-        return enum_property_impl<Class, T>(name, getter, ref_setter_func_ptr<Class, T>(nullptr));
+        return enum_property_impl<Class, T, detail::readonly_accessor<Class, T, ref_getter_func_ptr<Class, T>>>(name, getter);
     }
 
     /**********************************************************/
     template <typename Class, typename T, typename>
-    enum_property_impl<Class, T> enum_property(const std::string& name, val_getter_func_ptr<Class, T> getter)
+    constexpr enum_property_impl<Class, T, detail::readonly_accessor<Class, T, val_getter_func_ptr<Class, T>>> enum_property(string_view name, val_getter_func_ptr<Class, T> getter)
     {
-        return enum_property_impl<Class, T>(name, getter, val_setter_func_ptr<Class, T>(nullptr));
+        return enum_property_impl<Class, T, detail::readonly_accessor<Class, T, val_getter_func_ptr<Class, T>>>(name, getter);
     }
 
     /**********************************************************/
     template <typename Class, typename T, typename>
-    enum_property_impl<Class, T> enum_property(const std::string& name, ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter)
+    constexpr enum_property_impl<Class, T, detail::function_accessor<Class, T, ref_getter_func_ptr<Class, T>, ref_setter_func_ptr<Class, T>>> enum_property(string_view name, ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter)
     {
-        return enum_property_impl<Class, T>(name, getter, setter);
+        return enum_property_impl<Class, T, detail::function_accessor<Class, T, ref_getter_func_ptr<Class, T>, ref_setter_func_ptr<Class, T>>>(name, getter, setter);
     }
 
     /**********************************************************/
     template <typename Class, typename T, typename>
-    enum_property_impl<Class, T> enum_property(const std::string& name, val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter)
+    constexpr enum_property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, val_setter_func_ptr<Class, T>>> enum_property(string_view name, val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter)
     {
-        return enum_property_impl<Class, T>(name, getter, setter);
+        return enum_property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, val_setter_func_ptr<Class, T>>>(name, getter, setter);
     }
 
     /**********************************************************/
     template <typename Class, typename T, typename>
-    enum_property_impl<Class, T> enum_property(const std::string& name, val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter)
+    constexpr enum_property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, ref_setter_func_ptr<Class, T>>> enum_property(string_view name, val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter)
     {
-        return enum_property_impl<Class, T>(name, getter, setter);
+        return enum_property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, ref_setter_func_ptr<Class, T>>>(name, getter, setter);
     }
 
 } // namespace reflect
@@ -0,0 +1,138 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_HASH_HPP_
+#define _REFLECT_HASH_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef>     // Sizes of the hashed bytes.
+#include <cstdint>     // Fixed width hash values.
+#include <functional>  // Hashing types that have not been registered.
+#include <string>      // Hashing strings.
+#include <type_traits> // Selecting between the bitwise and per-property paths.
+#include <vector>      // Hashing arrays.
+
+//====================
+// Reflect includes
+//====================
+#include "meta_class.hpp"            // Iterating the registered properties.
+#include "detail/bitwise_layout.hpp" // Hashing plain structs as bytes.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /** @brief Scrambles the bits of a value, so that every input bit affects every output bit. */
+        std::uint64_t mix_hash(std::uint64_t value);
+
+        /** @brief Combines a hash with the hash of the next value of a sequence. */
+        std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t value);
+
+        /** @brief Hashes a range of bytes eight at a time, continuing from the seed. */
+        std::uint64_t hash_bytes(std::uint64_t seed, const void* data, std::size_t size);
+
+        /** @brief Hashes an arithmetic or enum value. */
+        template <typename T, typename = std::enable_if_t<std::is_integral<T>::value || std::is_enum<T>::value>>
+        std::uint64_t hash_value(std::uint64_t seed, T value);
+
+        /** @brief Hashes a floating point value, treating positive and negative zero as equal. */
+        template <typename T, typename = std::enable_if_t<std::is_floating_point<T>::value>, typename = void>
+        std::uint64_t hash_value(std::uint64_t seed, T value);
+
+        /** @brief Hashes a type that has not been registered through its std::hash specialization. */
+        template <typename T, typename = std::enable_if_t<!std::is_arithmetic<T>::value && !std::is_enum<T>::value && !is_registered<T>()>, typename = void, typename = void>
+        std::uint64_t hash_value(std::uint64_t seed, const T& value);
+
+        /** @brief Hashes a registered class by its registered properties. */
+        template <typename T, typename = std::enable_if_t<is_registered<T>()>, typename = void, typename = void, typename = void>
+        std::uint64_t hash_value(std::uint64_t seed, const T& value);
+
+        /** @brief Hashes the characters of a string in bulk. */
+        std::uint64_t hash_value(std::uint64_t seed, const std::string& value);
+
+        /** @brief Hashes vectors element by element, or as a single range of bytes if the elements are packed and bitwise comparable. */
+        template <typename T, typename = std::enable_if_t<!std::is_same<T, bool>::value>>
+        std::uint64_t hash_value(std::uint64_t seed, const std::vector<T>& values);
+
+        /** @brief Hashes each property through its getter, in registration order. */
+        template <typename Class>
+        std::uint64_t hash_properties(std::uint64_t seed, const Class& object, std::false_type);
+
+        /** @brief Hashes the byte ranges of the registered member variables of a bitwise comparable class. */
+        template <typename Class>
+        std::uint64_t hash_properties(std::uint64_t seed, const Class& object, std::true_type);
+
+    } // namespace detail
+
+    //====================
+    // Structs
+    //====================
+    /**
+     * Function object hashing registered classes with hash(). It can be used directly as the hasher of
+     * an unordered container, or inherited to specialize std::hash:
+     *
+     * @code
+     * namespace std
+     * {
+     *     template <>
+     *     struct hash<Account> : reflect::hasher<Account> {};
+     * }
+     * @endcode
+     */
+    template <typename Class>
+    struct hasher
+    {
+        /** @returns The hash of the registered properties of the object. */
+        std::size_t operator()(const Class& object) const;
+    };
+
+    //====================
+    // Functions
+    //====================
+    /**
+     * @brief Hashes the values of every registered property of an object, in registration order.
+     *
+     * Nested registered classes are hashed by their registered properties, and other types by their
+     * std::hash specialization. Classes that can be compared as bytes are hashed as the byte ranges
+     * of their registered members instead, so objects which are equal according to members_equal()
+     * always have the same hash. The hash is not stable across platforms or library versions.
+     *
+     * @param object The object to hash.
+     *
+     * @returns The hash of the object.
+     */
+    template <typename Class>
+    std::size_t hash(const Class& object);
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "hash.inl" // Method declarations.
+
+#endif//_REFLECT_HASH_HPP_
\ No newline at end of file
@@ -0,0 +1,195 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+//====================
+// C++ includes
+//====================
+#include <cstring> // Loading words from the hashed bytes.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**********************************************************/
+        inline std::uint64_t mix_hash(std::uint64_t value)
+        {
+            value ^= value >> 33;
+            value *= 0xff51afd7ed558ccdULL;
+            value ^= value >> 33;
+            value *= 0xc4ceb9fe1a85ec53ULL;
+            value ^= value >> 33;
+
+            return value;
+        }
+
+        /**********************************************************/
+        inline std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t value)
+        {
+            return mix_hash(seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)));
+        }
+
+        /**********************************************************/
+        inline std::uint64_t hash_bytes(std::uint64_t seed, const void* data, std::size_t size)
+        {
+            const std::uint64_t multiplier = 0xc6a4a7935bd1e995ULL;
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+            std::uint64_t hash = seed ^ (size * multiplier);
+            std::size_t position = 0;
+            for (; position + sizeof(std::uint64_t) <= size; position += sizeof(std::uint64_t))
+            {
+                std::uint64_t word;
+                std::memcpy(&word, bytes + position, sizeof(word));
+
+                word *= multiplier;
+                word ^= word >> 47;
+                word *= multiplier;
+                hash ^= word;
+                hash *= multiplier;
+            }
+
+            if (position != size)
+            {
+                std::uint64_t word = 0;
+                std::memcpy(&word, bytes + position, size - position);
+
+                hash ^= word;
+                hash *= multiplier;
+            }
+
+            return mix_hash(hash);
+        }
+
+        /**********************************************************/
+        template <typename T, typename>
+        std::uint64_t hash_value(std::uint64_t seed, T value)
+        {
+            return hash_combine(seed, static_cast<std::uint64_t>(value));
+        }
+
+        /**********************************************************/
+        template <typename T, typename, typename>
+        std::uint64_t hash_value(std::uint64_t seed, T value)
+        {
+            // Positive and negative zero compare equal, so must hash equally.
+            const double normalised = value == 0 ? 0.0 : static_cast<double>(value);
+
+            std::uint64_t bits;
+            std::memcpy(&bits, &normalised, sizeof(bits));
+
+            return hash_combine(seed, bits);
+        }
+
+        /**********************************************************/
+        template <typename T, typename, typename, typename>
+        std::uint64_t hash_value(std::uint64_t seed, const T& value)
+        {
+            return hash_combine(seed, static_cast<std::uint64_t>(std::hash<T>()(value)));
+        }
+
+        /**********************************************************/
+        template <typename T, typename, typename, typename, typename>
+        std::uint64_t hash_value(std::uint64_t seed, const T& value)
+        {
+            return hash_properties(seed, value, std::integral_constant<bool, bitwise_traits<T>::comparable>());
+        }
+
+        /**********************************************************/
+        inline std::uint64_t hash_value(std::uint64_t seed, const std::string& value)
+        {
+            return hash_bytes(seed, value.data(), value.size());
+        }
+
+        /**********************************************************/
+        template <typename T, typename>
+        std::uint64_t hash_value(std::uint64_t seed, const std::vector<T>& values)
+        {
+            if (bitwise_traits<T>::comparable && is_bitwise_packed<T>())
+            {
+                return hash_bytes(seed, values.data(), values.size() * sizeof(T));
+            }
+
+            std::uint64_t hash = hash_combine(seed, values.size());
+            for (const T& value : values)
+            {
+                hash = hash_value(hash, value);
+            }
+
+            return hash;
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        std::uint64_t hash_properties(std::uint64_t seed, const Class& object, std::false_type)
+        {
+            std::uint64_t hash = seed;
+            for_tuple([&object, &hash](const auto& member) {
+                member.visit(object, [&hash](const auto& value) {
+                    hash = hash_value(hash, value);
+                });
+            }, get_members<Class>());
+
+            return hash;
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        std::uint64_t hash_properties(std::uint64_t seed, const Class& object, std::true_type)
+        {
+            const char* bytes = reinterpret_cast<const char*>(&object);
+
+            std::uint64_t hash = seed;
+            for (const byte_range& range : bitwise_ranges<Class>())
+            {
+                hash = hash_bytes(hash, bytes + range.offset, range.size);
+            }
+
+            return hash;
+        }
+
+    } // namespace detail
+
+    //====================
+    // Operators
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    std::size_t hasher<Class>::operator()(const Class& object) const
+    {
+        return hash(object);
+    }
+
+    //====================
+    // Functions
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    std::size_t hash(const Class& object)
+    {
+        static_assert(is_registered<Class>(), "Only registered classes can be hashed.");
+        return static_cast<std::size_t>(detail::hash_value(0, object));
+    }
+
+} // namespace reflect
\ No newline at end of file
@@ -0,0 +1,285 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_JSON_READER_HPP_
+#define _REFLECT_JSON_READER_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef>     // Positions within the input.
+#include <string>      // Unescaping strings which cannot be viewed.
+#include <type_traits> // Selecting how each value is read.
+#include <vector>      // Reading arrays.
+
+//====================
+// Reflect includes
+//====================
+#include "string_view.hpp"           // Viewing the input.
+#include "enum_property.hpp"         // Reading enum values by their registered names.
+#include "meta_class.hpp"            // Iterating the registered properties.
+#include "detail/meta_exception.hpp" // Throwing on malformed input.
+
+namespace reflect
+{
+    class json_reader final
+    {
+    private:
+        //====================
+        // Member variables
+        //====================
+        /** The JSON being read, which is viewed rather than copied. */
+        string_view m_input;
+        /** The position of the next character to read. */
+        std::size_t m_position;
+        /** Reused storage for strings that contain escape sequences and cannot be viewed in place. */
+        std::string m_scratch;
+
+        //====================
+        // Private methods
+        //====================
+        /**
+         * @brief Throws an exception describing malformed input at the current position.
+         *
+         * @param message What was expected at the current position.
+         *
+         * @throws meta_exception As the input is malformed.
+         */
+        [[noreturn]] void error(const char* message) const;
+
+        /**
+         * @brief Skips any whitespace and retrieves the next character without consuming it.
+         *
+         * @returns The next character, or a null character at the end of the input.
+         */
+        char peek();
+
+        /**
+         * @brief Skips any whitespace and consumes the next character, which must match the expected character.
+         *
+         * @param c The expected character.
+         *
+         * @throws meta_exception If the next character does not match.
+         */
+        void expect(char c);
+
+        /**
+         * @brief Consumes the literal if it is next within the input.
+         *
+         * @param literal The characters to match.
+         *
+         * @returns True if the literal was matched and consumed.
+         */
+        bool consume(string_view literal);
+
+        /**
+         * @brief Reads the four hexadecimal digits of a unicode escape sequence.
+         *
+         * @returns The code unit of the escape sequence.
+         *
+         * @throws meta_exception If the digits are malformed.
+         */
+        unsigned int read_hex();
+
+        /**
+         * @brief Appends a code point to the scratch storage, encoded as UTF-8.
+         *
+         * @param code The code point to append.
+         */
+        void append_utf8(unsigned int code);
+
+        /**
+         * @brief Reads a string, viewing it in place within the input when it contains no escape sequences.
+         *
+         * @returns A view of the unescaped string, which is invalidated by the next string read.
+         *
+         * @throws meta_exception If the string is malformed.
+         */
+        string_view read_string();
+
+        /**
+         * @brief Consumes a run of decimal digits.
+         *
+         * @returns The number of digits consumed.
+         */
+        std::size_t skip_digits();
+
+        /**
+         * @brief Reads the characters of a number, without interpreting them.
+         *
+         * The characters must follow the JSON grammar for numbers, which has no leading plus sign or zeros,
+         * and requires digits after a decimal point or exponent.
+         *
+         * @returns A view of the number within the input.
+         *
+         * @throws meta_exception If no number is present, or it is malformed.
+         */
+        string_view read_number();
+
+        /**
+         * @brief Skips over the next value, including any nested objects or arrays, without storing it.
+         *
+         * @throws meta_exception If the value is malformed.
+         */
+        void skip_value();
+
+        /**
+         * @brief Reads the value of a key into a settable property, which is not an enum property, of the object.
+         *
+         * Values of read-only properties are skipped. Member variables are read in place, and values set
+         * through a setter start from the current value if they are registered classes, so that keys which
+         * are missing from nested objects leave those members untouched.
+         *
+         * @param member The registered property.
+         * @param object The object to set the value within.
+         */
+        template <typename Property, typename Class, typename = std::enable_if_t<!detail::is_enum_property<Property>::value>>
+        void read_member(const Property& member, Class& object);
+
+        /**
+         * @brief Reads the registered name of an enum value into an enum property of the object.
+         *
+         * @param member The registered property.
+         * @param object The object to set the value within.
+         *
+         * @throws meta_exception If the name has not been registered with the property.
+         */
+        template <typename Property, typename Class, typename = std::enable_if_t<detail::is_enum_property<Property>::value>, typename = void>
+        void read_member(const Property& member, Class& object);
+
+        /**
+         * @brief Retrieves the current value of a registered class, which keys from the input are then read into.
+         *
+         * @param member The registered property.
+         * @param object The object holding the value.
+         *
+         * @returns A copy of the current value.
+         */
+        template <typename Property, typename Class>
+        static typename Property::member_type initial_value(const Property& member, const Class& object, std::true_type);
+
+        /**
+         * @brief Creates the default value of any other type, which is replaced entirely by the input.
+         *
+         * @returns A default constructed value.
+         */
+        template <typename Property, typename Class>
+        static typename Property::member_type initial_value(const Property& member, const Class& object, std::false_type);
+
+        /** @brief Reads true or false. */
+        void read_value(bool& value);
+
+        /** @brief Reads an integer, which must fit within the type. */
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value> read_value(T& value);
+
+        /**
+         * @brief Reads a floating point number, where null is read as not-a-number.
+         *
+         * The number is parsed the same way whatever the C locale. A long double is read through double, so it
+         * has no more precision than double.
+         */
+        template <typename T>
+        std::enable_if_t<std::is_floating_point<T>::value> read_value(T& value);
+
+        /** @brief Reads an enum, which has no registered names, from its underlying integer. */
+        template <typename T>
+        std::enable_if_t<std::is_enum<T>::value> read_value(T& value);
+
+        /** @brief Reads and unescapes a string. */
+        void read_value(std::string& value);
+
+        /** @brief Reads an array, replacing the elements of the vector. */
+        template <typename T>
+        void read_value(std::vector<T>& values);
+
+        /** @brief Reads an object into a registered class, skipping any keys which are not registered. */
+        template <typename T>
+        std::enable_if_t<is_registered<T>()> read_value(T& value);
+
+    public:
+        //====================
+        // Ctors and dtor
+        //====================
+        /**
+         * @brief Constructor for reading from the specified JSON.
+         *
+         * @param input The JSON to read, which must outlive the reader.
+         */
+        explicit json_reader(string_view input);
+
+        /**
+         * @brief Default destructor.
+         */
+        ~json_reader() = default;
+
+        //====================
+        // Getters and setters
+        //====================
+        /**
+         * @brief Checks whether the whole input has been read, ignoring trailing whitespace.
+         *
+         * @returns True if there is nothing left to read.
+         */
+        bool at_end();
+
+        //====================
+        // Methods
+        //====================
+        /**
+         * @brief Reads the next JSON object within the input into a registered object.
+         *
+         * Each key is looked up through the name index of the class, and its value is parsed directly
+         * into the matching property without building a document. Keys are viewed within the input rather
+         * than copied, and the values of keys which are not registered are skipped. Registered properties
+         * which are missing from the object are left unchanged.
+         *
+         * @param object The object to read into.
+         *
+         * @throws meta_exception If the input is malformed or a value does not match the type of its property.
+         */
+        template <typename Class>
+        void read(Class& object);
+    };
+
+    //====================
+    // Functions
+    //====================
+    /**
+     * @brief Deserializes a JSON object into a registered object.
+     *
+     * @param json   The JSON to read, which must contain a single object.
+     * @param object The object to read into.
+     *
+     * @throws meta_exception If the input is malformed or contains anything after the object.
+     */
+    template <typename Class>
+    void from_json(string_view json, Class& object);
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "json_reader.inl" // Method declarations.
+
+#endif//_REFLECT_JSON_READER_HPP_
\ No newline at end of file
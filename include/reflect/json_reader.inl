@@ -0,0 +1,637 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+//====================
+// C++ includes
+//====================
+#include <clocale>   // Decimal separator expected when parsing.
+#include <cstdlib>   // Parsing floating point numbers.
+#include <cstring>   // Copying numbers to be parsed.
+#include <limits>    // Range checking integers.
+#include <stdexcept> // Catching unregistered enum names.
+
+namespace reflect
+{
+    //====================
+    // Ctors and dtor
+    //====================
+    /**********************************************************/
+    inline json_reader::json_reader(string_view input)
+        : m_input(input), m_position(0), m_scratch()
+    {
+        // Empty.
+    }
+
+    //====================
+    // Private methods
+    //====================
+    /**********************************************************/
+    inline void json_reader::error(const char* message) const
+    {
+        throw detail::meta_exception("Malformed JSON at offset " + std::to_string(m_position) + ": " + message + ".");
+    }
+
+    /**********************************************************/
+    inline char json_reader::peek()
+    {
+        while (m_position < m_input.size())
+        {
+            const char c = m_input[m_position];
+            if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+            {
+                return c;
+            }
+
+            ++m_position;
+        }
+
+        return '\0';
+    }
+
+    /**********************************************************/
+    inline void json_reader::expect(char c)
+    {
+        if (this->peek() != c)
+        {
+            char message[] = "Expected ' '";
+            message[10] = c;
+            this->error(message);
+        }
+
+        ++m_position;
+    }
+
+    /**********************************************************/
+    inline bool json_reader::consume(string_view literal)
+    {
+        this->peek();
+        if (m_input.size() - m_position < literal.size() || string_view(m_input.data() + m_position, literal.size()) != literal)
+        {
+            return false;
+        }
+
+        m_position += literal.size();
+        return true;
+    }
+
+    /**********************************************************/
+    inline unsigned int json_reader::read_hex()
+    {
+        if (m_input.size() - m_position < 4)
+        {
+            this->error("Unterminated unicode escape sequence");
+        }
+
+        unsigned int code = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            const char c = m_input[m_position++];
+            code <<= 4;
+            if (c >= '0' && c <= '9')
+            {
+                code |= static_cast<unsigned int>(c - '0');
+            }
+            else if (c >= 'a' && c <= 'f')
+            {
+                code |= static_cast<unsigned int>(c - 'a' + 10);
+            }
+            else if (c >= 'A' && c <= 'F')
+            {
+                code |= static_cast<unsigned int>(c - 'A' + 10);
+            }
+            else
+            {
+                this->error("Invalid unicode escape sequence");
+            }
+        }
+
+        return code;
+    }
+
+    /**********************************************************/
+    inline void json_reader::append_utf8(unsigned int code)
+    {
+        if (code < 0x80)
+        {
+            m_scratch.push_back(static_cast<char>(code));
+        }
+        else if (code < 0x800)
+        {
+            m_scratch.push_back(static_cast<char>(0xC0 | (code >> 6)));
+            m_scratch.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+        else if (code < 0x10000)
+        {
+            m_scratch.push_back(static_cast<char>(0xE0 | (code >> 12)));
+            m_scratch.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            m_scratch.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+        else
+        {
+            m_scratch.push_back(static_cast<char>(0xF0 | (code >> 18)));
+            m_scratch.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+            m_scratch.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            m_scratch.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+    }
+
+    /**********************************************************/
+    inline string_view json_reader::read_string()
+    {
+        this->expect('"');
+
+        // Strings without escape sequences are viewed directly within the input.
+        const std::size_t start = m_position;
+        while (m_position < m_input.size() && m_input[m_position] != '\\')
+        {
+            const char c = m_input[m_position++];
+            if (c == '"')
+            {
+                return string_view(m_input.data() + start, m_position - start - 1);
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                this->error("Unescaped control character within string");
+            }
+        }
+
+        m_scratch.assign(m_input.data() + start, m_position - start);
+        while (m_position < m_input.size())
+        {
+            const char c = m_input[m_position++];
+            if (c == '"')
+            {
+                return string_view(m_scratch);
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                this->error("Unescaped control character within string");
+            }
+            else if (c != '\\')
+            {
+                m_scratch.push_back(c);
+                continue;
+            }
+
+            if (m_position == m_input.size())
+            {
+                break;
+            }
+
+            switch (m_input[m_position++])
+            {
+            case '"':  m_scratch.push_back('"');  break;
+            case '\\': m_scratch.push_back('\\'); break;
+            case '/':  m_scratch.push_back('/');  break;
+            case 'b':  m_scratch.push_back('\b'); break;
+            case 'f':  m_scratch.push_back('\f'); break;
+            case 'n':  m_scratch.push_back('\n'); break;
+            case 'r':  m_scratch.push_back('\r'); break;
+            case 't':  m_scratch.push_back('\t'); break;
+            case 'u':
+                {
+                    unsigned int code = this->read_hex();
+                    if (code >= 0xD800 && code <= 0xDBFF)
+                    {
+                        // A high surrogate must be followed by an escaped low surrogate.
+                        if (!this->consume("\\u"))
+                        {
+                            this->error("Expected a low surrogate");
+                        }
+
+                        const unsigned int low = this->read_hex();
+                        if (low < 0xDC00 || low > 0xDFFF)
+                        {
+                            this->error("Invalid low surrogate");
+                        }
+
+                        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    else if (code >= 0xDC00 && code <= 0xDFFF)
+                    {
+                        this->error("Unexpected low surrogate");
+                    }
+
+                    this->append_utf8(code);
+                }
+                break;
+            default:
+                this->error("Invalid escape sequence");
+            }
+        }
+
+        this->error("Unterminated string");
+    }
+
+    /**********************************************************/
+    inline std::size_t json_reader::skip_digits()
+    {
+        const std::size_t start = m_position;
+        while (m_position < m_input.size() && m_input[m_position] >= '0' && m_input[m_position] <= '9')
+        {
+            ++m_position;
+        }
+
+        return m_position - start;
+    }
+
+    /**********************************************************/
+    inline string_view json_reader::read_number()
+    {
+        const char first = this->peek();
+        if ((first < '0' || first > '9') && first != '-')
+        {
+            this->error("Expected a value");
+        }
+
+        const std::size_t start = m_position;
+        if (first == '-')
+        {
+            ++m_position;
+        }
+
+        // The integer part is a single zero, or digits which do not start with a zero.
+        const std::size_t integer_start = m_position;
+        const std::size_t integer_digits = this->skip_digits();
+        if (integer_digits == 0 || (integer_digits > 1 && m_input[integer_start] == '0'))
+        {
+            this->error("Malformed number");
+        }
+
+        if (m_position < m_input.size() && m_input[m_position] == '.')
+        {
+            ++m_position;
+            if (this->skip_digits() == 0)
+            {
+                this->error("Malformed number");
+            }
+        }
+
+        if (m_position < m_input.size() && (m_input[m_position] == 'e' || m_input[m_position] == 'E'))
+        {
+            ++m_position;
+            if (m_position < m_input.size() && (m_input[m_position] == '+' || m_input[m_position] == '-'))
+            {
+                ++m_position;
+            }
+
+            if (this->skip_digits() == 0)
+            {
+                this->error("Malformed number");
+            }
+        }
+
+        return string_view(m_input.data() + start, m_position - start);
+    }
+
+    /**********************************************************/
+    inline void json_reader::skip_value()
+    {
+        // Nested objects and arrays are skipped by tracking their depth, so nothing is stored.
+        std::size_t depth = 0;
+        do
+        {
+            const char c = this->peek();
+            if (c == '"')
+            {
+                this->read_string();
+            }
+            else if (c == '{' || c == '[')
+            {
+                ++depth;
+                ++m_position;
+            }
+            else if (c == '}' || c == ']')
+            {
+                if (depth == 0)
+                {
+                    this->error("Expected a value");
+                }
+
+                --depth;
+                ++m_position;
+            }
+            else if (depth != 0 && (c == ',' || c == ':'))
+            {
+                ++m_position;
+            }
+            else if (c == '\0')
+            {
+                this->error("Unexpected end of input");
+            }
+            else if (!this->consume("true") && !this->consume("false") && !this->consume("null"))
+            {
+                this->read_number();
+            }
+        } while (depth != 0);
+    }
+
+    /**********************************************************/
+    template <typename Property, typename Class, typename>
+    void json_reader::read_member(const Property& member, Class& object)
+    {
+        if (!member.has_setter() && !member.has_member())
+        {
+            this->skip_value();
+            return;
+        }
+
+        // Member variables are read in place, so that keys missing from nested objects are left untouched.
+        if (member.has_member())
+        {
+            this->read_value(member.get_reference(object));
+            return;
+        }
+
+        using member_type = typename Property::member_type;
+
+        member_type value = initial_value(member, object, std::integral_constant<bool, is_registered<member_type>()>());
+        this->read_value(value);
+        member.set(object, std::move(value));
+    }
+
+    /**********************************************************/
+    template <typename Property, typename Class, typename, typename>
+    void json_reader::read_member(const Property& member, Class& object)
+    {
+        if (!member.has_setter() && !member.has_member())
+        {
+            this->skip_value();
+            return;
+        }
+
+        const string_view name = this->read_string();
+        try
+        {
+            member.set(object, member.from_string(name));
+        }
+        catch (const std::out_of_range&)
+        {
+            this->error("Unknown enum value");
+        }
+    }
+
+    /**********************************************************/
+    template <typename Property, typename Class>
+    typename Property::member_type json_reader::initial_value(const Property& member, const Class& object, std::true_type)
+    {
+        return member.get_copy(object);
+    }
+
+    /**********************************************************/
+    template <typename Property, typename Class>
+    typename Property::member_type json_reader::initial_value(const Property&, const Class&, std::false_type)
+    {
+        return typename Property::member_type();
+    }
+
+    /**********************************************************/
+    inline void json_reader::read_value(bool& value)
+    {
+        if (this->consume("true"))
+        {
+            value = true;
+        }
+        else if (this->consume("false"))
+        {
+            value = false;
+        }
+        else
+        {
+            this->error("Expected a boolean");
+        }
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value> json_reader::read_value(T& value)
+    {
+        const string_view number = this->read_number();
+
+        const bool negative = number[0] == '-';
+        std::size_t i = negative ? 1 : 0;
+        if (i == number.size())
+        {
+            this->error("Expected an integer");
+        }
+
+        unsigned long long magnitude = 0;
+        for (; i < number.size(); ++i)
+        {
+            const char c = number[i];
+            if (c < '0' || c > '9')
+            {
+                this->error("Expected an integer");
+            }
+
+            const unsigned long long digit = static_cast<unsigned long long>(c - '0');
+            if (magnitude > (std::numeric_limits<unsigned long long>::max() - digit) / 10)
+            {
+                this->error("Integer is out of range");
+            }
+
+            magnitude = magnitude * 10 + digit;
+        }
+
+        const unsigned long long max = static_cast<unsigned long long>(std::numeric_limits<T>::max());
+        const unsigned long long limit = !negative ? max : (std::is_signed<T>::value ? max + 1 : 0);
+        if (magnitude > limit)
+        {
+            this->error("Integer is out of range");
+        }
+
+        // Negative values are built from one less than the magnitude, so the minimum value does not overflow.
+        value = negative && magnitude != 0 ? static_cast<T>(-static_cast<long long>(magnitude - 1) - 1) : static_cast<T>(magnitude);
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<std::is_floating_point<T>::value> json_reader::read_value(T& value)
+    {
+        if (this->consume("null"))
+        {
+            value = std::numeric_limits<T>::quiet_NaN();
+            return;
+        }
+
+        const string_view number = this->read_number();
+
+        // The number is copied so that it is null-terminated for parsing, and its point is
+        // replaced by the decimal separator of the C locale, which strtod expects.
+        const char* separator = std::localeconv()->decimal_point;
+        const std::size_t separator_size = std::strlen(separator);
+
+        char buffer[64];
+        std::size_t size = 0;
+        for (const char c : number)
+        {
+            const char* source = c == '.' ? separator : &c;
+            const std::size_t source_size = c == '.' ? separator_size : 1;
+            if (size + source_size >= sizeof(buffer))
+            {
+                this->error("Number is too long");
+            }
+
+            std::memcpy(buffer + size, source, source_size);
+            size += source_size;
+        }
+        buffer[size] = '\0';
+
+        char* end = nullptr;
+        const double parsed = std::strtod(buffer, &end);
+        if (end != buffer + size)
+        {
+            this->error("Expected a number");
+        }
+
+        value = static_cast<T>(parsed);
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<std::is_enum<T>::value> json_reader::read_value(T& value)
+    {
+        std::underlying_type_t<T> underlying = std::underlying_type_t<T>();
+        this->read_value(underlying);
+        value = static_cast<T>(underlying);
+    }
+
+    /**********************************************************/
+    inline void json_reader::read_value(std::string& value)
+    {
+        const string_view view = this->read_string();
+        value.assign(view.data(), view.size());
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void json_reader::read_value(std::vector<T>& values)
+    {
+        values.clear();
+
+        this->expect('[');
+        if (this->peek() == ']')
+        {
+            ++m_position;
+            return;
+        }
+
+        while (true)
+        {
+            T element = T();
+            this->read_value(element);
+            values.push_back(std::move(element));
+
+            const char c = this->peek();
+            ++m_position;
+            if (c == ']')
+            {
+                return;
+            }
+            else if (c != ',')
+            {
+                this->error("Expected ',' or ']'");
+            }
+        }
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<is_registered<T>()> json_reader::read_value(T& value)
+    {
+        const auto& index = detail::metadata_t<T, decltype(register_class<T>())>::index();
+
+        this->expect('{');
+        if (this->peek() == '}')
+        {
+            ++m_position;
+            return;
+        }
+
+        while (true)
+        {
+            // The key is only needed for the lookup, so it can be viewed within the scratch storage.
+            const std::size_t position = index.find(this->read_string());
+            this->expect(':');
+
+            if (position == index.size())
+            {
+                this->skip_value();
+            }
+            else
+            {
+                detail::for_tuple_at<void>(position, [this, &value](const auto& member) {
+                    this->read_member(member, value);
+                }, get_members<T>());
+            }
+
+            const char c = this->peek();
+            ++m_position;
+            if (c == '}')
+            {
+                return;
+            }
+            else if (c != ',')
+            {
+                this->error("Expected ',' or '}'");
+            }
+        }
+    }
+
+    //====================
+    // Getters and setters
+    //====================
+    /**********************************************************/
+    inline bool json_reader::at_end()
+    {
+        this->peek();
+        return m_position >= m_input.size();
+    }
+
+    //====================
+    // Methods
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    void json_reader::read(Class& object)
+    {
+        static_assert(is_registered<Class>(), "Only registered classes can be read from JSON.");
+        this->read_value(object);
+    }
+
+    //====================
+    // Functions
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    void from_json(string_view json, Class& object)
+    {
+        json_reader reader(json);
+        reader.read(object);
+
+        if (!reader.at_end())
+        {
+            throw detail::meta_exception("Malformed JSON: unexpected characters after the object.");
+        }
+    }
+
+} // namespace reflect
\ No newline at end of file
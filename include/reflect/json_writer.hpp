@@ -0,0 +1,265 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_JSON_WRITER_HPP_
+#define _REFLECT_JSON_WRITER_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef>     // Sizes of the written values.
+#include <string>      // Output buffer and string values.
+#include <type_traits> // Selecting how each value is written.
+#include <vector>      // Writing arrays and storing the cached keys.
+
+//====================
+// Reflect includes
+//====================
+#include "string_view.hpp"   // Writing viewed strings.
+#include "enum_property.hpp" // Writing enum values by their registered names.
+#include "meta_class.hpp"    // Iterating the registered properties.
+#include "dirty_set.hpp"     // Writing only the changed properties.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**
+         * @brief Copies the characters to the output, escaped so they can be placed within a JSON string.
+         *
+         * Runs of characters that do not need escaping are copied in a single call. The output must have
+         * room for six times the number of characters, as each may be escaped as a unicode sequence.
+         *
+         * @param out  The characters to write to.
+         * @param data The characters to escape.
+         * @param size The number of characters to escape.
+         *
+         * @returns The number of characters written to the output.
+         */
+        std::size_t escape_json(char* out, const char* data, std::size_t size);
+
+        /**
+         * @brief Retrieves the JSON keys of the registered properties of a class.
+         *
+         * The keys are escaped, quoted and followed by a colon once per class, and every key after the
+         * first is preceded by a comma, so that they can be appended to the output without any checks.
+         *
+         * @returns The keys of the properties, in the order they were registered.
+         */
+        template <typename Class>
+        const std::vector<std::string>& json_keys();
+
+    } // namespace detail
+
+    class json_writer final
+    {
+    private:
+        //====================
+        // Member variables
+        //====================
+        /** The buffer the JSON is written to, which is only grown and never shrunk. */
+        std::vector<char> m_buffer;
+        /** The number of characters that have been written to the buffer. */
+        std::size_t m_size;
+
+        //====================
+        // Private methods
+        //====================
+        /**
+         * @brief Ensures the buffer has room for the specified number of characters after the written characters.
+         *
+         * @param size The number of characters that will be written.
+         *
+         * @returns A pointer to the end of the written characters.
+         */
+        char* reserve(std::size_t size);
+
+        /**
+         * @brief Appends the characters to the buffer.
+         *
+         * @param data The characters to append.
+         * @param size The number of characters to append.
+         */
+        void append(const char* data, std::size_t size);
+
+        /**
+         * @brief Appends a single character to the buffer.
+         *
+         * @param c The character to append.
+         */
+        void append(char c);
+
+        /**
+         * @brief Appends the characters to the buffer as an escaped and quoted JSON string.
+         *
+         * @param data The characters to append.
+         * @param size The number of characters to append.
+         */
+        void append_string(const char* data, std::size_t size);
+
+        /**
+         * @brief Writes the value of a property, which is not an enum property, of the object.
+         *
+         * The value is visited rather than copied out of the object.
+         *
+         * @param member The registered property.
+         * @param object The object to read the value from.
+         */
+        template <typename Property, typename Class, typename = std::enable_if_t<!detail::is_enum_property<Property>::value>>
+        void write_member(const Property& member, const Class& object);
+
+        /**
+         * @brief Writes the value of an enum property of the object as its registered name.
+         *
+         * @param member The registered property.
+         * @param object The object to read the value from.
+         *
+         * @throws out_of_range If the value has not been registered with the property.
+         */
+        template <typename Property, typename Class, typename = std::enable_if_t<detail::is_enum_property<Property>::value>, typename = void>
+        void write_member(const Property& member, const Class& object);
+
+        /** @brief Writes a boolean as true or false. */
+        void write_value(bool value);
+
+        /** @brief Writes an integer, formatted directly into the buffer. */
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value> write_value(T value);
+
+        /**
+         * @brief Writes a floating point number with enough digits to be read back exactly, or null if it is not finite.
+         *
+         * The number always uses a point as its separator, whatever the C locale. A long double is written through
+         * double, so any precision beyond that of double is lost.
+         */
+        template <typename T>
+        std::enable_if_t<std::is_floating_point<T>::value> write_value(T value);
+
+        /** @brief Writes an enum, which has no registered names, as its underlying integer. */
+        template <typename T>
+        std::enable_if_t<std::is_enum<T>::value> write_value(T value);
+
+        /** @brief Writes an escaped string. */
+        void write_value(const std::string& value);
+
+        /** @brief Writes an escaped string. */
+        void write_value(string_view value);
+
+        /** @brief Writes each element of the vector within an array. */
+        template <typename T>
+        void write_value(const std::vector<T>& values);
+
+        /** @brief Writes a registered class as an object, with a key for each of its registered properties. */
+        template <typename T>
+        std::enable_if_t<is_registered<T>()> write_value(const T& value);
+
+    public:
+        //====================
+        // Ctors and dtor
+        //====================
+        /**
+         * @brief Constructor for creating a writer with an empty buffer.
+         */
+        explicit json_writer();
+
+        /**
+         * @brief Default destructor.
+         */
+        ~json_writer() = default;
+
+        //====================
+        // Getters and setters
+        //====================
+        /**
+         * @brief Retrieves a view of the JSON that has been written.
+         *
+         * The view is invalidated when more JSON is written or the writer is cleared.
+         *
+         * @returns The contents of the buffer.
+         */
+        string_view view() const;
+
+        /**
+         * @brief Retrieves a copy of the JSON that has been written.
+         *
+         * @returns The contents of the buffer.
+         */
+        std::string str() const;
+
+        //====================
+        // Methods
+        //====================
+        /**
+         * @brief Appends a registered object to the buffer as a JSON object.
+         *
+         * The registered properties are iterated at compile time, and each key and value is appended
+         * straight to the buffer without building an intermediate tree. Arithmetic values, strings,
+         * enums, vectors and nested registered classes are supported.
+         *
+         * @param object The object to write.
+         */
+        template <typename Class>
+        void write(const Class& object);
+
+        /**
+         * @brief Appends the dirty properties of a registered object to the buffer as a JSON object, then clears them.
+         *
+         * Only the properties marked in the dirty set are written, in registration order, so that an
+         * object which has barely changed is not serialized again in full. The result can be read back
+         * with from_json(), which leaves the properties that are missing untouched.
+         *
+         * @param object The object to write.
+         * @param dirty  The properties to write, which are all marked clean afterwards.
+         */
+        template <typename Class>
+        void write_dirty(const Class& object, dirty_set<Class>& dirty);
+
+        /**
+         * @brief Empties the buffer, keeping its capacity so it can be reused for the next object.
+         */
+        void clear();
+    };
+
+    //====================
+    // Functions
+    //====================
+    /**
+     * @brief Serializes a registered object to a JSON string.
+     *
+     * @param object The object to serialize.
+     *
+     * @returns The object as a JSON object.
+     */
+    template <typename Class>
+    std::string to_json(const Class& object);
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "json_writer.inl" // Method declarations.
+
+#endif//_REFLECT_JSON_WRITER_HPP_
\ No newline at end of file
@@ -0,0 +1,371 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+//====================
+// C++ includes
+//====================
+#include <cmath>   // Checking floating point numbers are finite.
+#include <cstdio>  // Formatting floating point numbers.
+#include <cstring> // Copying characters into the buffer.
+#include <limits>  // Digits needed to read floating point numbers back.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**********************************************************/
+        inline std::size_t escape_json(char* out, const char* data, std::size_t size)
+        {
+            static const char hex[] = "0123456789abcdef";
+
+            char* const begin = out;
+            std::size_t start = 0;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                const unsigned char c = static_cast<unsigned char>(data[i]);
+                if (c >= 0x20 && c != '"' && c != '\\')
+                {
+                    continue;
+                }
+
+                std::memcpy(out, data + start, i - start);
+                out += i - start;
+                start = i + 1;
+
+                *out++ = '\\';
+                switch (c)
+                {
+                case '"':  *out++ = '"';  break;
+                case '\\': *out++ = '\\'; break;
+                case '\b': *out++ = 'b';  break;
+                case '\f': *out++ = 'f';  break;
+                case '\n': *out++ = 'n';  break;
+                case '\r': *out++ = 'r';  break;
+                case '\t': *out++ = 't';  break;
+                default:
+                    *out++ = 'u';
+                    *out++ = '0';
+                    *out++ = '0';
+                    *out++ = hex[c >> 4];
+                    *out++ = hex[c & 0xF];
+                    break;
+                }
+            }
+
+            std::memcpy(out, data + start, size - start);
+            out += size - start;
+
+            return static_cast<std::size_t>(out - begin);
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        const std::vector<std::string>& json_keys()
+        {
+            static const std::vector<std::string> keys = [] {
+                std::vector<std::string> result;
+                for_tuple([&result](const auto& member) {
+                    const string_view name = member.get_name();
+
+                    std::string key(name.size() * 6, '\0');
+                    key.resize(escape_json(&key[0], name.data(), name.size()));
+                    key.insert(0, result.empty() ? "\"" : ",\"");
+                    key.append("\":", 2);
+
+                    result.push_back(std::move(key));
+                }, get_members<Class>());
+
+                return result;
+            }();
+
+            return keys;
+        }
+
+    } // namespace detail
+
+    //====================
+    // Ctors and dtor
+    //====================
+    /**********************************************************/
+    inline json_writer::json_writer()
+        : m_buffer(), m_size(0)
+    {
+        // Empty.
+    }
+
+    //====================
+    // Private methods
+    //====================
+    /**********************************************************/
+    inline char* json_writer::reserve(std::size_t size)
+    {
+        if (m_size + size > m_buffer.size())
+        {
+            const std::size_t doubled = m_buffer.size() * 2;
+            m_buffer.resize(doubled > m_size + size ? doubled : m_size + size);
+        }
+
+        return m_buffer.data() + m_size;
+    }
+
+    /**********************************************************/
+    inline void json_writer::append(const char* data, std::size_t size)
+    {
+        std::memcpy(this->reserve(size), data, size);
+        m_size += size;
+    }
+
+    /**********************************************************/
+    inline void json_writer::append(char c)
+    {
+        *this->reserve(1) = c;
+        ++m_size;
+    }
+
+    /**********************************************************/
+    inline void json_writer::append_string(const char* data, std::size_t size)
+    {
+        char* out = this->reserve(size * 6 + 2);
+        *out++ = '"';
+        const std::size_t escaped = detail::escape_json(out, data, size);
+        out[escaped] = '"';
+
+        m_size += escaped + 2;
+    }
+
+    /**********************************************************/
+    template <typename Property, typename Class, typename>
+    void json_writer::write_member(const Property& member, const Class& object)
+    {
+        member.visit(object, [this](const auto& value) {
+            this->write_value(value);
+        });
+    }
+
+    /**********************************************************/
+    template <typename Property, typename Class, typename, typename>
+    void json_writer::write_member(const Property& member, const Class& object)
+    {
+        this->write_value(member.to_string(member.get_copy(object)));
+    }
+
+    /**********************************************************/
+    inline void json_writer::write_value(bool value)
+    {
+        if (value)
+        {
+            this->append("true", 4);
+        }
+        else
+        {
+            this->append("false", 5);
+        }
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value> json_writer::write_value(T value)
+    {
+        using unsigned_type = std::make_unsigned_t<T>;
+
+        // Digits are written backwards from the end of the buffer.
+        char buffer[24];
+        char* const end = buffer + sizeof(buffer);
+        char* begin = end;
+
+        const bool negative = value < T();
+        unsigned_type magnitude = negative ? unsigned_type(0) - static_cast<unsigned_type>(value) : static_cast<unsigned_type>(value);
+        do
+        {
+            *--begin = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+
+        if (negative)
+        {
+            *--begin = '-';
+        }
+
+        this->append(begin, static_cast<std::size_t>(end - begin));
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<std::is_floating_point<T>::value> json_writer::write_value(T value)
+    {
+        if (!std::isfinite(value))
+        {
+            this->append("null", 4);
+            return;
+        }
+
+        // Values are formatted through double, so long double is limited to the precision of double.
+        const int precision = std::numeric_limits<T>::max_digits10 < std::numeric_limits<double>::max_digits10 ? std::numeric_limits<T>::max_digits10 : std::numeric_limits<double>::max_digits10;
+
+        char buffer[32];
+        const int size = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, static_cast<double>(value));
+
+        // The decimal separator follows the C locale, so whatever it is gets replaced by a point.
+        char* out = buffer;
+        for (int i = 0; i < size; ++i)
+        {
+            const char c = buffer[i];
+            if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == 'e')
+            {
+                *out++ = c;
+            }
+            else if (out == buffer || out[-1] != '.')
+            {
+                *out++ = '.';
+            }
+        }
+
+        this->append(buffer, static_cast<std::size_t>(out - buffer));
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<std::is_enum<T>::value> json_writer::write_value(T value)
+    {
+        this->write_value(static_cast<std::underlying_type_t<T>>(value));
+    }
+
+    /**********************************************************/
+    inline void json_writer::write_value(const std::string& value)
+    {
+        this->append_string(value.data(), value.size());
+    }
+
+    /**********************************************************/
+    inline void json_writer::write_value(string_view value)
+    {
+        this->append_string(value.data(), value.size());
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void json_writer::write_value(const std::vector<T>& values)
+    {
+        this->append('[');
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            if (i != 0)
+            {
+                this->append(',');
+            }
+
+            this->write_value(values[i]);
+        }
+        this->append(']');
+    }
+
+    /**********************************************************/
+    template <typename T>
+    std::enable_if_t<is_registered<T>()> json_writer::write_value(const T& value)
+    {
+        const std::vector<std::string>& keys = detail::json_keys<T>();
+
+        this->append('{');
+        std::size_t index = 0;
+        detail::for_tuple([this, &keys, &index, &value](const auto& member) {
+            const std::string& key = keys[index++];
+            this->append(key.data(), key.size());
+            this->write_member(member, value);
+        }, get_members<T>());
+        this->append('}');
+    }
+
+    //====================
+    // Getters and setters
+    //====================
+    /**********************************************************/
+    inline string_view json_writer::view() const
+    {
+        return string_view(m_buffer.data(), m_size);
+    }
+
+    /**********************************************************/
+    inline std::string json_writer::str() const
+    {
+        return std::string(m_buffer.data(), m_size);
+    }
+
+    //====================
+    // Methods
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    void json_writer::write(const Class& object)
+    {
+        static_assert(is_registered<Class>(), "Only registered classes can be written as JSON.");
+        this->write_value(object);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    void json_writer::write_dirty(const Class& object, dirty_set<Class>& dirty)
+    {
+        static_assert(is_registered<Class>(), "Only registered classes can be written as JSON.");
+        const std::vector<std::string>& keys = detail::json_keys<Class>();
+
+        // Only the marked properties are dispatched to, so a single change costs one write however many properties there are.
+        this->append('{');
+        bool first = true;
+        for (std::size_t position = dirty.find_next(0); position < dirty_set<Class>::property_count; position = dirty.find_next(position + 1))
+        {
+            // Every key after the first is preceded by a comma, which is skipped if no key has been written yet.
+            const std::string& key = keys[position];
+            const std::size_t skip = first && position != 0 ? 1 : 0;
+            this->append(key.data() + skip, key.size() - skip);
+            detail::for_tuple_at<void>(position, [this, &object](const auto& member) {
+                this->write_member(member, object);
+            }, get_members<Class>());
+            first = false;
+        }
+        this->append('}');
+
+        dirty.clear();
+    }
+
+    /**********************************************************/
+    inline void json_writer::clear()
+    {
+        m_size = 0;
+    }
+
+    //====================
+    // Functions
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    std::string to_json(const Class& object)
+    {
+        json_writer writer;
+        writer.write(object);
+
+        return writer.str();
+    }
+
+} // namespace reflect
\ No newline at end of file
@@ -0,0 +1,229 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_MEMBER_HANDLE_HPP_
+#define _REFLECT_MEMBER_HANDLE_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef>     // Positions along a property path.
+#include <type_traits> // Checking the type of the bound property.
+#include <utility>     // Moving values into the bound property.
+
+//====================
+// Reflect includes
+//====================
+#include "property.hpp"              // Pointers to the bound member variables.
+#include "detail/meta_exception.hpp" // Throwing when the handle is unbound.
+
+namespace reflect
+{
+    namespace detail
+    {
+        /** A property bound to a dotted path through nested registered classes. */
+        template <typename Class, std::size_t... Chain>
+        class property_path;
+
+    } // namespace detail
+
+    template <typename Class, typename T>
+    class member_handle final
+    {
+    private:
+        //====================
+        // Aliases
+        //====================
+        /** Alias for the function that retrieves the value from the bound property. */
+        using getter_type = T (*)(const void*, const Class&);
+
+        /** Alias for the function that sets the value through the bound property. */
+        using setter_type = void (*)(const void*, Class&, const T&);
+
+        /** Alias for the function that moves the value through the bound property. */
+        using move_setter_type = void (*)(const void*, Class&, T&&);
+
+        //====================
+        // Member variables
+        //====================
+        /** The member variable the bound property accesses directly, or null if it uses methods. */
+        member_ptr<Class, T> m_member;
+        /** The registered property that the handle is bound to. */
+        const void* m_property;
+        /** Retrieves the value of the member variable through the bound property. */
+        getter_type m_getter;
+        /** Sets the value of the member variable through the bound property. */
+        setter_type m_setter;
+        /** Moves a value into the member variable through the bound property. */
+        move_setter_type m_move_setter;
+
+        //====================
+        // Private methods
+        //====================
+        /**
+         * @brief Retrieves the value of the member variable through a property of a known type.
+         *
+         * @param property The property the handle is bound to.
+         * @param obj      The object instance to return the data from.
+         *
+         * @returns A copy of the underlying mapped data.
+         */
+        template <typename Property>
+        static T get_thunk(const void* property, const Class& obj);
+
+        /**
+         * @brief Sets the value of the member variable through a property of a known type.
+         *
+         * @param property The property the handle is bound to.
+         * @param obj      The object instance to set the data within.
+         * @param value    The value to set within the class.
+         */
+        template <typename Property>
+        static void set_thunk(const void* property, Class& obj, const T& value);
+
+        /**
+         * @brief Moves the value into the member variable through a property of a known type.
+         *
+         * @param property The property the handle is bound to.
+         * @param obj      The object instance to set the data within.
+         * @param value    The value to move into the class.
+         */
+        template <typename Property>
+        static void move_thunk(const void* property, Class& obj, T&& value);
+
+        /** @throws meta_exception As an unbound handle cannot retrieve a value. */
+        static T unbound_get(const void* property, const Class& obj);
+
+        /** @throws meta_exception As an unbound handle cannot set a value. */
+        static void unbound_set(const void* property, Class& obj, const T& value);
+
+        /** @throws meta_exception As an unbound handle cannot move a value. */
+        static void unbound_move(const void* property, Class& obj, T&& value);
+
+        /**
+         * @brief Retrieves the member variable a registered property is bound to.
+         *
+         * @param property The property the handle is being bound to.
+         *
+         * @returns The pointer to the member variable, or null if the property uses methods.
+         */
+        template <typename Property>
+        static member_ptr<Class, T> member_of(const Property& property);
+
+        /** @returns Null, as a path is a chain of properties rather than a single member variable. */
+        template <std::size_t... Chain>
+        static member_ptr<Class, T> member_of(const detail::property_path<Class, Chain...>& path);
+
+    public:
+        using class_type = Class;
+        using member_type = T;
+
+        //====================
+        // Ctors and dtor
+        //====================
+        /**
+         * @brief Constructor for creating an unbound handle.
+         *
+         * An unbound handle is returned when a name could not be resolved. Getting or setting
+         * values through it throws; check it with is_valid first.
+         */
+        explicit member_handle();
+
+        /**
+         * @brief Constructor for binding the handle to a registered property.
+         *
+         * The property must be one of the registered properties of the class, as the handle
+         * only stores its address and relies on the registered tuple outliving it. A property
+         * bound to a member variable is accessed through the member pointer, which costs the
+         * same as accessing the variable. Any other property is accessed through one indirect
+         * call, which the compiler cannot inline, before its getter or setter is called.
+         *
+         * @param property The registered property to bind to.
+         */
+        template <typename Property>
+        explicit member_handle(const Property& property);
+
+        /**
+         * @brief Default destructor.
+         */
+        ~member_handle() = default;
+
+        //====================
+        // Getters and setters
+        //====================
+        /**
+         * @brief Retrieves a copy of the member variable the handle is bound to.
+         *
+         * @param obj The object instance to return the data from.
+         *
+         * @returns A copy of the underlying mapped data.
+         *
+         * @throws meta_exception If the handle is unbound.
+         */
+        T get(const Class& obj) const;
+
+        /**
+         * @brief Sets the member variable the handle is bound to.
+         *
+         * @param obj   The object instance to set the data within.
+         * @param value The value to set within the class.
+         *
+         * @throws meta_exception If the handle is unbound, or the bound property has no setter or member pointer.
+         */
+        void set(Class& obj, const T& value) const;
+
+        /**
+         * @brief Moves a value into the member variable the handle is bound to.
+         *
+         * @param obj   The object instance to set the data within.
+         * @param value The value to move into the class.
+         *
+         * @throws meta_exception If the handle is unbound, or the bound property has no setter or member pointer.
+         */
+        void set(Class& obj, T&& value) const;
+
+        /**
+         * @brief Checks whether the handle has been bound to a registered property.
+         *
+         * @returns True if the handle can be used to get and set values.
+         */
+        bool is_valid() const;
+
+        //====================
+        // Operators
+        //====================
+        /**
+         * @brief Checks whether the handle has been bound to a registered property.
+         *
+         * @returns True if the handle can be used to get and set values.
+         */
+        explicit operator bool() const;
+    };
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "member_handle.inl" // Method declarations.
+
+#endif//_REFLECT_MEMBER_HANDLE_HPP_
\ No newline at end of file
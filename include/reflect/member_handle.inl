@@ -0,0 +1,167 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+namespace reflect
+{
+    //====================
+    // Ctors and dtor
+    //====================
+    /**********************************************************/
+    template <typename Class, typename T>
+    member_handle<Class, T>::member_handle()
+        : m_member(nullptr), m_property(nullptr), m_getter(&unbound_get), m_setter(&unbound_set), m_move_setter(&unbound_move)
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    template <typename Class, typename T>
+    template <typename Property>
+    member_handle<Class, T>::member_handle(const Property& property)
+        : m_member(member_of(property)), m_property(&property), m_getter(&get_thunk<Property>), m_setter(&set_thunk<Property>), m_move_setter(&move_thunk<Property>)
+    {
+        static_assert(std::is_same<typename Property::member_type, T>::value, "The property does not match the datatype of the handle.");
+    }
+
+    //====================
+    // Private methods
+    //====================
+    /**********************************************************/
+    template <typename Class, typename T>
+    template <typename Property>
+    T member_handle<Class, T>::get_thunk(const void* property, const Class& obj)
+    {
+        return static_cast<const Property*>(property)->get_copy(obj);
+    }
+
+    /**********************************************************/
+    template <typename Class, typename T>
+    template <typename Property>
+    void member_handle<Class, T>::set_thunk(const void* property, Class& obj, const T& value)
+    {
+        static_cast<const Property*>(property)->set(obj, value);
+    }
+
+    /**********************************************************/
+    template <typename Class, typename T>
+    template <typename Property>
+    void member_handle<Class, T>::move_thunk(const void* property, Class& obj, T&& value)
+    {
+        static_cast<const Property*>(property)->set(obj, std::move(value));
+    }
+
+    /**********************************************************/
+    template <typename Class, typename T>
+    T member_handle<Class, T>::unbound_get(const void*, const Class&)
+    {
+        throw detail::meta_exception("Cannot get value: the handle is unbound.");
+    }
+
+    /**********************************************************/
+    template <typename Class, typename T>
+    void member_handle<Class, T>::unbound_set(const void*, Class&, const T&)
+    {
+        throw detail::meta_exception("Cannot set value: the handle is unbound.");
+    }
+
+    /**********************************************************/
+    template <typename Class, typename T>
+    void member_handle<Class, T>::unbound_move(const void*, Class&, T&&)
+    {
+        throw detail::meta_exception("Cannot set value: the handle is unbound.");
+    }
+
+    /**********************************************************/
+    template <typename Class, typename T>
+    template <typename Property>
+    member_ptr<Class, T> member_handle<Class, T>::member_of(const Property& property)
+    {
+        return property.has_member() ? property.get_member() : nullptr;
+    }
+
+    /**********************************************************/
+    template <typename Class, typename T>
+    template <std::size_t... Chain>
+    member_ptr<Class, T> member_handle<Class, T>::member_of(const detail::property_path<Class, Chain...>&)
+    {
+        return nullptr;
+    }
+
+    //====================
+    // Getters and setters
+    //====================
+    /**********************************************************/
+    template <typename Class, typename T>
+    T member_handle<Class, T>::get(const Class& obj) const
+    {
+        if (m_member != nullptr)
+        {
+            return obj.*m_member;
+        }
+
+        return m_getter(m_property, obj);
+    }
+
+    /**********************************************************/
+    template <typename Class, typename T>
+    void member_handle<Class, T>::set(Class& obj, const T& value) const
+    {
+        if (m_member != nullptr)
+        {
+            obj.*m_member = value;
+            return;
+        }
+
+        m_setter(m_property, obj, value);
+    }
+
+    /**********************************************************/
+    template <typename Class, typename T>
+    void member_handle<Class, T>::set(Class& obj, T&& value) const
+    {
+        if (m_member != nullptr)
+        {
+            obj.*m_member = std::move(value);
+            return;
+        }
+
+        m_move_setter(m_property, obj, std::move(value));
+    }
+
+    /**********************************************************/
+    template <typename Class, typename T>
+    bool member_handle<Class, T>::is_valid() const
+    {
+        return m_property != nullptr;
+    }
+
+    //====================
+    // Operators
+    //====================
+    /**********************************************************/
+    template <typename Class, typename T>
+    member_handle<Class, T>::operator bool() const
+    {
+        return this->is_valid();
+    }
+
+} // namespace reflect
\ No newline at end of file
@@ -0,0 +1,45 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_MEMBER_STATUS_HPP_
+#define _REFLECT_MEMBER_STATUS_HPP_
+
+namespace reflect
+{
+    /**
+     * @brief The outcome of accessing a member variable through the non-throwing meta_class methods.
+     */
+    enum class member_status
+    {
+        /** The member variable was found and accessed. */
+        found,
+        /** No member variable is registered with the name. */
+        not_found,
+        /** The member variable does not match the supplied datatype. */
+        type_mismatch,
+        /** The member variable has no setter or member pointer, so it cannot be set. */
+        read_only
+    };
+
+} // namespace reflect
+
+#endif//_REFLECT_MEMBER_STATUS_HPP_
\ No newline at end of file
@@ -31,6 +31,15 @@
 #include <utility>      // Random utility functions.
 #include <string>       // Name of the meta class retrieved as a string.
 
+//====================
+// Reflect includes
+//====================
+#include "string_view.hpp"   // Names of the registered members.
+#include "property.hpp"      // Retrieving the types of the registered members.
+#include "member_handle.hpp" // Resolving members ahead of time.
+#include "member_status.hpp" // Reporting the outcome of non-throwing accesses.
+#include "value.hpp"         // Holding values whose type is only known at runtime.
+
 namespace reflect
 {
     //====================
@@ -49,7 +58,7 @@ namespace reflect
      * @returns The properties of the meta-class.
      */
     template <typename... Args>
-    auto properties(Args&&... args);
+    constexpr auto properties(Args&&... args);
 
     /**
      * @brief Registers the meta-data of a class.
@@ -62,7 +71,7 @@ namespace reflect
      * @param The registration details of the class as meta-information.
      */
     template <typename Class>
-    inline auto register_class();
+    constexpr auto register_class();
 
     /**
      * @brief Registers a name with the meta engine.
@@ -97,6 +106,23 @@ namespace reflect
     template <typename Class>
     const auto& get_members();
 
+    /**
+     * @brief Invokes a function with the dotted path and value of every leaf member of an object.
+     *
+     * Properties whose type is itself a registered class are descended into rather than visited, so
+     * that a registered position property is visited as "position.x" and "position.y". The recursion
+     * is expanded at compile time and each value is visited in place through the registered getters
+     * or member pointers. The paths are built once per class, so visiting allocates nothing.
+     *
+     * @param object The object to visit.
+     * @param f      The function to invoke with the path, as a string_view, and a constant reference to each value.
+     */
+    template <typename Class, typename F>
+    void visit_deep(const Class& object, F&& f);
+
+    template <typename Class>
+    class dirty_set;
+
     template <typename Class>
     class meta_class final
     {
@@ -106,6 +132,151 @@ namespace reflect
         //====================
         /** The object that this meta-information can read and alter. */
         Class& m_object;
+        /** The properties of the object which have been set, if they are being tracked. */
+        dirty_set<Class>* m_dirty;
+
+        //====================
+        // Private methods
+        //====================
+        /**
+         * @brief Throws the exception for a property which does not match the supplied datatype.
+         *
+         * @param name The name of the registered property.
+         *
+         * @throws meta_exception As the property does not match the supplied datatype.
+         */
+        [[noreturn]] static void throw_type_mismatch(string_view name);
+
+        /**
+         * @brief Marks the property at the position as dirty, if changes are being tracked.
+         *
+         * @param position The position of the top-level property that has been set, as found when it was dispatched to.
+         */
+        void mark_dirty(std::size_t position);
+
+        /**
+         * @brief Creates the value returned by get_member() for a name which is not registered.
+         *
+         * @param name The name which was not found.
+         *
+         * @returns A default constructed value.
+         */
+        template <typename T>
+        static std::enable_if_t<std::is_default_constructible<T>::value, T> missing_value(string_view name);
+
+        /**
+         * @brief Throws for a name which is not registered, as there is no default value of the datatype to return.
+         *
+         * @param name The name which was not found.
+         *
+         * @returns Nothing.
+         *
+         * @throws meta_exception As the member variable was not found.
+         */
+        template <typename T>
+        static std::enable_if_t<!std::is_default_constructible<T>::value, T> missing_value(string_view name);
+
+        /**
+         * @brief Invokes the function with the property if it matches the supplied datatype.
+         *
+         * @param member The registered property.
+         * @param name   The name of the registered property.
+         * @param f      The function to invoke with the property.
+         *
+         * @returns The result of the invoked function.
+         */
+        template <typename T, typename R, typename Property, typename F>
+        static std::enable_if_t<std::is_same<get_member_type<Property>, T>::value, R> invoke_typed(const Property& member, string_view name, F& f);
+
+        /**
+         * @brief Errorneous method that is invoked if the property does not match the supplied datatype.
+         *
+         * @param member The registered property.
+         * @param name   The name of the registered property.
+         * @param f      The function that would have been invoked with the property.
+         *
+         * @returns Nothing.
+         *
+         * @throws meta_exception As the property does not match the supplied datatype.
+         */
+        template <typename T, typename R, typename Property, typename F>
+        static std::enable_if_t<!std::is_same<get_member_type<Property>, T>::value, R> invoke_typed(const Property& member, string_view name, F& f);
+
+        /**
+         * @brief Invokes the function with the property at the specified position within the registered tuple.
+         *
+         * @param position The index of the property, as retrieved from the name index.
+         * @param name     The name of the registered property.
+         * @param f        The function to invoke with the property.
+         *
+         * @returns The result of the invoked function.
+         *
+         * @throws meta_exception If the property does not match the supplied datatype.
+         */
+        template <typename T, typename R, typename F>
+        static R dispatch(std::size_t position, string_view name, F&& f);
+
+        /**
+         * @brief Invokes the function with the property if it matches the supplied datatype.
+         *
+         * @param member The registered property.
+         * @param f      The function to invoke with the property and the root position.
+         * @param root   The position of the top-level property, which the property is or descends from.
+         *
+         * @returns The status returned by the invoked function.
+         */
+        template <typename T, typename Property, typename F>
+        static std::enable_if_t<std::is_same<get_member_type<Property>, T>::value, member_status> try_invoke_typed(const Property& member, F& f, std::size_t root);
+
+        /**
+         * @brief Non-throwing method that is invoked if the property does not match the supplied datatype.
+         *
+         * @param member The registered property.
+         * @param f      The function that would have been invoked with the property.
+         * @param root   The position of the top-level property, which the property is or descends from.
+         *
+         * @returns member_status::type_mismatch.
+         */
+        template <typename T, typename Property, typename F>
+        static std::enable_if_t<!std::is_same<get_member_type<Property>, T>::value, member_status> try_invoke_typed(const Property& member, F& f, std::size_t root);
+
+        /**
+         * @brief Invokes the function with the named property without throwing or allocating.
+         *
+         * The function is invoked with the property and the position of the top-level property it is or
+         * descends from, so that the position does not need to be looked up again.
+         *
+         * @param name The name of the registered property.
+         * @param f    The function to invoke with the property, which returns the status of the access.
+         *
+         * @returns The status returned by the function, or the reason it was not invoked.
+         */
+        template <typename T, typename F>
+        static member_status try_dispatch(string_view name, F&& f);
+
+        /**
+         * @brief Invokes the function with the property at a dotted path, such as "position.x", without throwing.
+         *
+         * @param name The dotted path to the nested property.
+         * @param f    The function to invoke with the path, which returns the status of the access.
+         *
+         * @returns The status returned by the function, or the reason it was not invoked.
+         */
+        template <typename T, typename F>
+        static member_status try_dispatch_path(string_view name, F& f);
+
+        /**
+         * @brief Invokes the function with the named property or dotted path, whatever its datatype.
+         *
+         * The function is invoked with the property and its top-level position, as with try_dispatch().
+         *
+         * @param name The name of the registered property.
+         * @param f    The function to invoke with the property, which returns the status of the access.
+         *
+         * @returns The status returned by the function, or member_status::not_found.
+         */
+        template <typename F>
+        static member_status try_dispatch_any(string_view name, F&& f);
 
     public:
         //====================
@@ -131,6 +302,18 @@ namespace reflect
          */
         explicit meta_class(Class& object);
 
+        /**
+         * @brief Constructor for the meta_class object, tracking which properties are set.
+         *
+         * Each property that is successfully set through set_member(), try_set_member() or
+         * set_enum_member_from_string() is marked in the dirty set, by its position in registration order.
+         * Setting a dotted path marks the top-level property it descends from.
+         *
+         * @param object The object that the meta-data will represent.
+         * @param dirty  The set to mark the changed properties in, which must outlive the meta_class.
+         */
+        explicit meta_class(Class& object, dirty_set<Class>& dirty);
+
         /**
          * @brief Default destructor for the meta_class object.
          */
@@ -152,21 +335,82 @@ namespace reflect
          * @brief Retrieves the value of the specified member variable.
          *
          * When this method is invoked, it will retrieve the metadata value associated
-         * with the key. If the key is not found, the templated default value is returned.
+         * with the key, copy constructing it straight from the member variable or getter. If the key is not
+         * found, the templated default value is returned, or a meta_exception is thrown if the datatype is not
+         * default constructible.
+         * Members of nested registered classes are named by dotted paths, such as "position.x",
+         * here and in the other methods which look members up by name.
          *
          * @tparam T   The data-type of the variable to retrieve.
          * @param name The name of the member variable to retrieve.
          *
          * @returns The associated variable of the metadata.
+         *
+         * @throws meta_exception If the member variable does not match the supplied datatype.
+         */
+        template <typename T>
+        T get_member(string_view name);
+
+        /**
+         * @brief Retrieves the value of the specified member variable without throwing.
+         *
+         * The value is only written to if the member variable is found and matches the supplied
+         * datatype. No exceptions are thrown and no memory is allocated to report a failure.
+         *
+         * @tparam T    The data-type of the variable to retrieve.
+         * @param name  The name of the member variable to retrieve.
+         * @param value The variable to write the retrieved value to.
+         *
+         * @returns member_status::found on success, otherwise not_found or type_mismatch.
          */
         template <typename T>
-        T get_member(const std::string& name);
+        member_status try_get_member(string_view name, T& value);
 
+        /**
+         * @brief Invokes a function with the value of the specified member variable.
+         *
+         * The function is passed a constant reference if the member variable is bound with a member
+         * pointer or a getter which returns a reference, otherwise it is passed the value returned by the
+         * getter. The value is never copied into an intermediate variable, so the function should accept
+         * its argument generically, for example as a const auto&.
+         *
+         * @param name The name of the member variable to visit.
+         * @param f    The function to invoke with the value.
+         *
+         * @returns True if a member variable with the given name was found and visited.
+         */
+        template <typename F>
+        bool visit_member(string_view name, F&& f);
+
+        /**
+         * @brief Retrieves the registered name of the value of an enum member variable.
+         *
+         * A dotted path is converted through the enum property at the end of the path, which must be
+         * registered with enum_property.
+         *
+         * @param name The name of the member variable to retrieve.
+         *
+         * @returns The registered name of the enum value, or an empty string if the member variable was not found.
+         *
+         * @throws out_of_range If the enum value has not been registered with the property.
+         */
         template <typename T, typename = std::enable_if_t<std::is_enum<T>::value>>
-        std::string get_enum_member_as_string(const std::string& name);
+        std::string get_enum_member_as_string(string_view name);
 
+        /**
+         * @brief Sets an enum member variable to the value registered with the given name.
+         *
+         * A dotted path is converted through the enum property at the end of the path, which must be
+         * registered with enum_property. If the member variable is not found, no information is changed.
+         *
+         * @param name  The name of the member variable to set.
+         * @param value The registered name of the enum value, which is not copied.
+         *
+         * @throws out_of_range If no enum value has been registered with the given name.
+         * @throws meta_exception If the member variable does not match the supplied datatype, or cannot be set.
+         */
         template <typename T, typename = std::enable_if<std::is_enum<T>::value>>
-        void set_enum_member_from_string(const std::string& name, const std::string& value);
+        void set_enum_member_from_string(string_view name, string_view value);
 
         /**
          * @brief Checks for the existence of a registered member variable.
@@ -175,22 +419,73 @@ namespace reflect
          *
          * @returns True if the member variable with the given name was found.
          */
-        bool has_member(const std::string& name);
+        bool has_member(string_view name);
 
         /**
          * @brief Sets the specified member variable to a desired value.
          *
          * When this method is invoked, it can be used to map a specific value
          * to a registered member within the meta engine. If the value is not found,
-         * no information is changed.
+         * no information is changed. The value is forwarded through to the member variable
+         * or setter, so an rvalue is moved rather than copied.
+         *
+         * @param name  The name of the registered member variable.
+         * @param value The value to set to the member variable.
+         *
+         * @throws meta_exception If no setter has been registered with the member variable, or
+         *                        the member variable does not match the supplied datatype.
+         */
+        template <typename T, typename V, typename = std::enable_if_t<std::is_constructible<T, V>::value>>
+        void set_member(string_view name, V&& value);
+
+        /**
+         * @brief Sets the specified member variable to a desired value without throwing.
+         *
+         * The value is forwarded through to the member variable or setter as with set_member, but a
+         * missing, mismatched or read-only member variable is reported through the returned status
+         * rather than an exception, and the object is left unchanged.
          *
          * @param name  The name of the registered member variable.
          * @param value The value to set to the member variable.
          *
-         * @throws runtime_error If no setter has been registered with the member variable.
+         * @returns member_status::found on success, otherwise not_found, type_mismatch or read_only.
          */
         template <typename T, typename V, typename = std::enable_if_t<std::is_constructible<T, V>::value>>
-        void set_member(const std::string& name, V&& value);
+        member_status try_set_member(string_view name, V&& value);
+
+        /**
+         * @brief Retrieves a copy of the specified member variable, whatever its datatype.
+         *
+         * Arithmetic types, enums and short strings are held within the returned value without allocating.
+         *
+         * @param name The name of the member variable to retrieve.
+         *
+         * @returns The value of the member variable, or an empty value if it was not found.
+         */
+        value get_value(string_view name);
+
+        /**
+         * @brief Sets the specified member variable to the held value, which must be of the exact datatype of the member.
+         *
+         * If the member variable is not found, no information is changed.
+         *
+         * @param name  The name of the registered member variable.
+         * @param value The value to set to the member variable.
+         *
+         * @throws meta_exception If no setter has been registered with the member variable, or
+         *                        the value does not hold the datatype of the member variable.
+         */
+        void set_value(string_view name, const value& value);
+
+        /**
+         * @brief Sets the specified member variable to the held value without throwing.
+         *
+         * @param name  The name of the registered member variable.
+         * @param value The value to set to the member variable.
+         *
+         * @returns member_status::found on success, otherwise not_found, type_mismatch or read_only.
+         */
+        member_status try_set_value(string_view name, const value& value);
 
         //====================
         // Methods
@@ -204,7 +499,7 @@ namespace reflect
          *
          * @param f The lambda to iterate the meta-data with.
          */
-        template <typename F, typename = std::enable_if_t<is_registered<Class>()>>
+        template <typename F, typename C = Class, typename = std::enable_if_t<is_registered<C>()>>
         void for_each(F&& f);
 
         /**
@@ -217,20 +512,69 @@ namespace reflect
          *
          * @param f The lambda to iterate the meta-data with.
          */
-        template <typename F, typename = std::enable_if_t<!is_registered<Class>()>, typename = void>
+        template <typename F, typename C = Class, typename = std::enable_if_t<!is_registered<C>()>, typename = void>
         void for_each(F&& f);
 
+        /**
+         * @brief Iterator method that takes a lambda to visit every leaf member, descending into nested registered classes.
+         *
+         * The lambda is invoked with the dotted path of each leaf member, such as "position.x", and a
+         * constant reference to its value. See visit_deep().
+         *
+         * @param f The lambda to visit the leaf members with.
+         */
+        template <typename F>
+        void for_each_deep(F&& f) const;
+
         /**
          * @brief Method that will invoke a lambda when the specified member variable is encountered.
          *
-         * When the specified member variable is encountered whilst iterating through the meta-data of
-         * the class, the supplied lambda will be invoked for additional behavior.
+         * The member variable is located through the name index of the class, rather than iterating
+         * through the meta-data, and the supplied lambda is invoked with the matching property for
+         * additional behavior. If no member variable is registered with the name, the lambda is not invoked.
+         *
+         * @throws meta_exception If the member variable does not match the supplied datatype.
          *
          * @param name The name of the meta-data member variable.
          * @param f    The lambda to invoke when the member variable has been found.
          */
         template <typename T, typename F>
-        void for_member(const std::string& name, F&& f);
+        static void for_member(string_view name, F&& f);
+
+        /**
+         * @brief Method that will invoke a lambda with the named member variable or dotted path.
+         *
+         * Behaves as for_member(), but names which are not registered with the class itself are looked
+         * up as dotted paths to members of nested registered classes. The lambda is then invoked with a
+         * property path, which only offers the accessors common to properties, such as get_copy, set,
+         * visit and get_member, so it must not rely on those specific to enum properties.
+         *
+         * @throws meta_exception If the member variable does not match the supplied datatype.
+         *
+         * @param name The name of the member variable, or a dotted path to a nested member variable.
+         * @param f    The lambda to invoke when the member variable has been found.
+         */
+        template <typename T, typename F>
+        static void for_path(string_view name, F&& f);
+
+        /**
+         * @brief Resolves a registered member variable into a reusable handle.
+         *
+         * When this method is invoked, the name is looked up and type checked once, and the
+         * returned handle is bound directly to the registered property. The handle can then be used
+         * to get and set the member variable on any instance of the class without repeating the lookup.
+         * A dotted path is resolved into the chain of nested properties, so the handle accesses each
+         * level directly. If no member variable is registered with the name, an unbound handle is returned.
+         *
+         * @tparam T   The data-type of the variable to resolve.
+         * @param name The name of the member variable to resolve.
+         *
+         * @returns A handle bound to the registered member variable.
+         *
+         * @throws meta_exception If the member variable does not match the supplied datatype.
+         */
+        template <typename T>
+        static member_handle<Class, T> resolve(string_view name);
     };
 
 } // namespace reflect
@@ -32,6 +32,9 @@
 #include "enum_property.hpp"           // Retrieving information on enum properties.
 #include "detail/template_helpers.hpp" // Methods for iterating tuples.
 #include "detail/metadata.hpp"         // Stores the information of each meta_class.
+#include "detail/deep_visit.hpp"       // Descending into nested registered classes.
+#include "detail/property_path.hpp"    // Resolving dotted paths to nested properties.
+#include "dirty_set.hpp"               // Tracking the properties which have been set.
 
 namespace reflect
 {
@@ -41,11 +44,162 @@ namespace reflect
     /**********************************************************/
     template <typename Class>
     meta_class<Class>::meta_class(Class& object)
-        : m_object(object)
+        : m_object(object), m_dirty(nullptr)
     {
         // Empty.
     }
 
+    /**********************************************************/
+    template <typename Class>
+    meta_class<Class>::meta_class(Class& object, dirty_set<Class>& dirty)
+        : m_object(object), m_dirty(&dirty)
+    {
+        // Empty.
+    }
+
+    //====================
+    // Private methods
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    void meta_class<Class>::throw_type_mismatch(string_view name)
+    {
+        std::string err = std::string("Member variable: ") + name.to_string() + std::string(" does not match the supplied datatype.");
+        throw detail::meta_exception(err);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    void meta_class<Class>::mark_dirty(std::size_t position)
+    {
+        if (m_dirty != nullptr)
+        {
+            m_dirty->mark(position);
+        }
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T>
+    std::enable_if_t<std::is_default_constructible<T>::value, T> meta_class<Class>::missing_value(string_view)
+    {
+        return T();
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T>
+    std::enable_if_t<!std::is_default_constructible<T>::value, T> meta_class<Class>::missing_value(string_view name)
+    {
+        throw detail::meta_exception(std::string("Member variable: ") + name.to_string() + std::string(" was not found."));
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T, typename R, typename Property, typename F>
+    std::enable_if_t<std::is_same<get_member_type<Property>, T>::value, R> meta_class<Class>::invoke_typed(const Property& member, string_view, F& f)
+    {
+        return f(member);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T, typename R, typename Property, typename F>
+    std::enable_if_t<!std::is_same<get_member_type<Property>, T>::value, R> meta_class<Class>::invoke_typed(const Property&, string_view name, F&)
+    {
+        throw_type_mismatch(name);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T, typename R, typename F>
+    R meta_class<Class>::dispatch(std::size_t position, string_view name, F&& f)
+    {
+        return detail::for_tuple_at<R>(position, [name, &f](const auto& member) -> R {
+            return invoke_typed<T, R>(member, name, f);
+        }, get_members<Class>());
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T, typename Property, typename F>
+    std::enable_if_t<std::is_same<get_member_type<Property>, T>::value, member_status> meta_class<Class>::try_invoke_typed(const Property& member, F& f, std::size_t root)
+    {
+        return f(member, root);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T, typename Property, typename F>
+    std::enable_if_t<!std::is_same<get_member_type<Property>, T>::value, member_status> meta_class<Class>::try_invoke_typed(const Property&, F&, std::size_t)
+    {
+        return member_status::type_mismatch;
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T, typename F>
+    member_status meta_class<Class>::try_dispatch(string_view name, F&& f)
+    {
+        const auto& index = detail::metadata_t<Class, decltype(register_class<Class>())>::index();
+
+        const std::size_t position = index.find(name);
+        if (position == index.size())
+        {
+            return try_dispatch_path<T>(name, f);
+        }
+
+        return detail::for_tuple_at<member_status>(position, [&f, position](const auto& member) {
+            return try_invoke_typed<T>(member, f, position);
+        }, get_members<Class>());
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T, typename F>
+    member_status meta_class<Class>::try_dispatch_path(string_view name, F& f)
+    {
+        const auto& index = detail::nested_paths<Class>::index();
+
+        const std::size_t position = index.find(name);
+        if (position == index.size())
+        {
+            return member_status::not_found;
+        }
+
+        return detail::for_tuple_at<member_status>(position, [&f](const auto& path) {
+            return try_invoke_typed<T>(path, f, path.get_root());
+        }, detail::nested_paths<Class>::paths());
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename F>
+    member_status meta_class<Class>::try_dispatch_any(string_view name, F&& f)
+    {
+        const auto& index = detail::metadata_t<Class, decltype(register_class<Class>())>::index();
+
+        const std::size_t position = index.find(name);
+        if (position != index.size())
+        {
+            return detail::for_tuple_at<member_status>(position, [&f, position](const auto& member) {
+                return f(member, position);
+            }, get_members<Class>());
+        }
+
+        const auto& path_index = detail::nested_paths<Class>::index();
+
+        const std::size_t path_position = path_index.find(name);
+        if (path_position != path_index.size())
+        {
+            return detail::for_tuple_at<member_status>(path_position, [&f](const auto& path) {
+                return f(path, path.get_root());
+            }, detail::nested_paths<Class>::paths());
+        }
+
+        return member_status::not_found;
+    }
+
     //====================
     // Getters and setters
     //====================
@@ -59,24 +213,85 @@ namespace reflect
     /**********************************************************/
     template <typename Class>
     template <typename T>
-    T meta_class<Class>::get_member(const std::string& name)
+    T meta_class<Class>::get_member(string_view name)
+    {
+        // The value is returned straight from the property, rather than assigned into a default value.
+        const auto get_copy = [this](const auto& member) -> T {
+            return member.get_copy(m_object);
+        };
+
+        const auto& index = detail::metadata_t<Class, decltype(register_class<Class>())>::index();
+
+        const std::size_t position = index.find(name);
+        if (position != index.size())
+        {
+            return dispatch<T, T>(position, name, get_copy);
+        }
+
+        const auto& path_index = detail::nested_paths<Class>::index();
+
+        const std::size_t path_position = path_index.find(name);
+        if (path_position != path_index.size())
+        {
+            return detail::for_tuple_at<T>(path_position, [name, &get_copy](const auto& path) -> T {
+                return invoke_typed<T, T>(path, name, get_copy);
+            }, detail::nested_paths<Class>::paths());
+        }
+
+        return missing_value<T>(name);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T>
+    member_status meta_class<Class>::try_get_member(string_view name, T& value)
     {
-        T value;
-        this->for_member<T>(name, [&value, this](const auto& member) {
-            value = member.get(m_object);
+        return try_dispatch<T>(name, [&value, this](const auto& member, std::size_t) {
+            value = member.get_copy(m_object);
+            return member_status::found;
         });
+    }
 
-        return value;
+    /**********************************************************/
+    template <typename Class>
+    template <typename F>
+    bool meta_class<Class>::visit_member(string_view name, F&& f)
+    {
+        const auto& index = detail::metadata_t<Class, decltype(register_class<Class>())>::index();
+
+        const std::size_t position = index.find(name);
+        if (position != index.size())
+        {
+            detail::for_tuple_at<void>(position, [&f, this](const auto& member) {
+                member.visit(m_object, f);
+            }, get_members<Class>());
+
+            return true;
+        }
+
+        const auto& path_index = detail::nested_paths<Class>::index();
+
+        const std::size_t path_position = path_index.find(name);
+        if (path_position != path_index.size())
+        {
+            detail::for_tuple_at<void>(path_position, [&f, this](const auto& path) {
+                path.visit(m_object, f);
+            }, detail::nested_paths<Class>::paths());
+
+            return true;
+        }
+
+        return false;
     }
 
     /**********************************************************/
     template <typename Class>
     template <typename T, typename>
-    std::string meta_class<Class>::get_enum_member_as_string(const std::string& name)
+    std::string meta_class<Class>::get_enum_member_as_string(string_view name)
     {
         std::string value;
-        this->for_member<T>(name, [&value, this](const auto& member) {
-            value = member.to_string(member.get(m_object));
+        this->for_path<T>(name, [&value, this](const auto& member) {
+            value = member.to_string(member.get_copy(m_object)).to_string();
         });
 
         return value;
@@ -85,22 +300,70 @@ namespace reflect
     /**********************************************************/
     template <typename Class>
     template <typename T, typename>
-    void meta_class<Class>::set_enum_member_from_string(const std::string& name, const std::string& value)
+    void meta_class<Class>::set_enum_member_from_string(string_view name, string_view value)
     {
-        this->for_member<T>(name, [&value, this](const auto& member) {
+        const member_status status = try_dispatch<T>(name, [&value, this](const auto& member, std::size_t root) {
             member.set(m_object, member.from_string(value));
+            this->mark_dirty(root);
+            return member_status::found;
         });
+
+        if (status == member_status::type_mismatch)
+        {
+            throw_type_mismatch(name);
+        }
     }
 
     /**********************************************************/
     template <typename Class>
-    bool meta_class<Class>::has_member(const std::string& name)
+    bool meta_class<Class>::has_member(string_view name)
     {
-        bool result = false;
-        this->for_each([&result, name, this](const auto& member) {
-            if (member.get_name() == name) {
-                result = true;
+        const auto& index = detail::metadata_t<Class, decltype(register_class<Class>())>::index();
+        const auto& path_index = detail::nested_paths<Class>::index();
+
+        return index.find(name) != index.size() || path_index.find(name) != path_index.size();
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T, typename V, typename>
+    void meta_class<Class>::set_member(string_view name, V&& value)
+    {
+        const member_status status = this->try_set_member<T>(name, std::forward<V>(value));
+        if (status == member_status::type_mismatch)
+        {
+            throw_type_mismatch(name);
+        }
+        else if (status == member_status::read_only)
+        {
+            throw detail::meta_exception("Cannot set value: no setters or member pointer set.");
+        }
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T, typename V, typename>
+    member_status meta_class<Class>::try_set_member(string_view name, V&& value)
+    {
+        return try_dispatch<T>(name, [&value, this](const auto& member, std::size_t root) {
+            if (!member.has_setter() && !member.has_member())
+            {
+                return member_status::read_only;
             }
+
+            member.set(m_object, std::forward<V>(value));
+            this->mark_dirty(root);
+            return member_status::found;
+        });
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    value meta_class<Class>::get_value(string_view name)
+    {
+        value result;
+        this->visit_member(name, [&result](const auto& member_value) {
+            result = value(member_value);
         });
 
         return result;
@@ -108,11 +371,40 @@ namespace reflect
 
     /**********************************************************/
     template <typename Class>
-    template <typename T, typename V, typename>
-    void meta_class<Class>::set_member(const std::string& name, V&& value)
+    void meta_class<Class>::set_value(string_view name, const value& value)
+    {
+        const member_status status = this->try_set_value(name, value);
+        if (status == member_status::type_mismatch)
+        {
+            throw_type_mismatch(name);
+        }
+        else if (status == member_status::read_only)
+        {
+            throw detail::meta_exception("Cannot set value: no setters or member pointer set.");
+        }
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    member_status meta_class<Class>::try_set_value(string_view name, const value& value)
     {
-        this->for_member<T>(name, [this, value = std::forward<V>(value)](const auto& member) {
-            member.set(m_object, value);
+        return try_dispatch_any(name, [&value, this](const auto& member, std::size_t root) {
+            using member_type = get_member_type<decltype(member)>;
+
+            const member_type* held = value.template get_if<member_type>();
+            if (held == nullptr)
+            {
+                return member_status::type_mismatch;
+            }
+
+            if (!member.has_setter() && !member.has_member())
+            {
+                return member_status::read_only;
+            }
+
+            member.set(m_object, *held);
+            this->mark_dirty(root);
+            return member_status::found;
         });
     }
 
@@ -121,7 +413,7 @@ namespace reflect
     //====================
     /**********************************************************/
     template <typename Class>
-    template <typename F, typename>
+    template <typename F, typename, typename>
     void meta_class<Class>::for_each(F&& f)
     {
         detail::for_tuple(std::forward<F>(f), get_members<Class>());
@@ -129,29 +421,92 @@ namespace reflect
 
     /**********************************************************/
     template <typename Class>
-    template <typename F, typename, typename>
+    template <typename F, typename, typename, typename>
     void meta_class<Class>::for_each(F&& f)
     {
         // Empty.
     }
 
+    /**********************************************************/
+    template <typename Class>
+    template <typename F>
+    void meta_class<Class>::for_each_deep(F&& f) const
+    {
+        visit_deep(m_object, std::forward<F>(f));
+    }
+
     /**********************************************************/
     template <typename Class>
     template <typename T, typename F>
-    void meta_class<Class>::for_member(const std::string& name, F&& f)
+    void meta_class<Class>::for_member(string_view name, F&& f)
     {
-        this->for_each([&](const auto& member) {
-            if (name == member.get_name()) 
-            {
-                if (!std::is_same<get_member_type<decltype(member)>, T>::value)
-                {
-                    std::string err = std::string("Member variable: ") + name + std::string("does not match the supplied datatype.");
-                    throw detail::meta_exception(err);
-                }
+        const auto& index = detail::metadata_t<Class, decltype(register_class<Class>())>::index();
+        
+        const std::size_t position = index.find(name);
+        if (position == index.size())
+        {
+            return;
+        }
 
-                detail::call_if<std::is_same<get_member_type<decltype(member)>, T>::value>(std::forward<F>(f), member);
-            }
-        });
+        dispatch<T, void>(position, name, std::forward<F>(f));
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T, typename F>
+    void meta_class<Class>::for_path(string_view name, F&& f)
+    {
+        const auto& index = detail::metadata_t<Class, decltype(register_class<Class>())>::index();
+
+        const std::size_t position = index.find(name);
+        if (position != index.size())
+        {
+            dispatch<T, void>(position, name, std::forward<F>(f));
+            return;
+        }
+
+        const auto& path_index = detail::nested_paths<Class>::index();
+
+        const std::size_t path_position = path_index.find(name);
+        if (path_position != path_index.size())
+        {
+            detail::for_tuple_at<void>(path_position, [name, &f](const auto& path) {
+                invoke_typed<T, void>(path, name, f);
+            }, detail::nested_paths<Class>::paths());
+        }
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T>
+    member_handle<Class, T> meta_class<Class>::resolve(string_view name)
+    {
+        member_handle<Class, T> handle;
+        auto bind = [&handle](const auto& member) {
+            handle = member_handle<Class, T>(member);
+        };
+
+        const auto& index = detail::metadata_t<Class, decltype(register_class<Class>())>::index();
+
+        const std::size_t position = index.find(name);
+        if (position != index.size())
+        {
+            dispatch<T, void>(position, name, bind);
+            return handle;
+        }
+
+        // Paths offer the same interface as the registered properties, so handles bind to them in the same way.
+        const auto& path_index = detail::nested_paths<Class>::index();
+
+        const std::size_t path_position = path_index.find(name);
+        if (path_position != path_index.size())
+        {
+            detail::for_tuple_at<void>(path_position, [name, &bind](const auto& path) {
+                invoke_typed<T, void>(path, name, bind);
+            }, detail::nested_paths<Class>::paths());
+        }
+
+        return handle;
     }
 
     //====================
@@ -159,14 +514,14 @@ namespace reflect
     //====================
     /**********************************************************/
     template <typename... Args>
-    auto properties(Args&&... args)
+    constexpr auto properties(Args&&... args)
     {
         return std::make_tuple(std::forward<Args>(args)...);
     }
 
     /**********************************************************/
     template <typename Class>
-    inline auto register_class()
+    constexpr auto register_class()
     {
         return std::make_tuple();
     }
@@ -192,4 +547,14 @@ namespace reflect
         return detail::metadata_t<Class, decltype(register_class<Class>())>::members;
     }
 
+    /**********************************************************/
+    template <typename Class, typename F>
+    void visit_deep(const Class& object, F&& f)
+    {
+        static_assert(is_registered<Class>(), "Only registered classes can be visited.");
+
+        const std::string* path = detail::deep_paths<Class>().data();
+        detail::visit_leaves(object, f, path);
+    }
+
 } // end of namespace reflect
@@ -0,0 +1,290 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_META_OBJECT_HPP_
+#define _REFLECT_META_OBJECT_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef> // Positions of the properties.
+#include <string>  // Describing failed accesses.
+
+//====================
+// Reflect includes
+//====================
+#include "string_view.hpp"           // Naming the member variables.
+#include "member_status.hpp"         // Reporting the outcome of non-throwing accesses.
+#include "registry.hpp"              // The type-erased operations of each class.
+#include "value.hpp"                 // Holding values whose type is only known at runtime.
+#include "detail/meta_exception.hpp" // Reporting failed accesses.
+
+namespace reflect
+{
+    class meta_object final
+    {
+    private:
+        //====================
+        // Member variables
+        //====================
+        /** The object that this meta-information can read and alter. */
+        void* m_object;
+        /** The type-erased operations of the class of the object. */
+        const meta_type* m_type;
+
+        //====================
+        // Private methods
+        //====================
+        /**
+         * @brief Throws an exception describing a failed access.
+         *
+         * @param status The outcome of the access, which was not found.
+         * @param name   The name of the member variable.
+         */
+        [[noreturn]] static void throw_status(member_status status, string_view name);
+
+        /**
+         * @brief Retrieves the type-erased operations of the class of the object, for an access.
+         *
+         * @returns The type of the object.
+         *
+         * @throws meta_exception If the handle does not refer to an object.
+         */
+        const meta_type& checked_type() const;
+
+        /**
+         * @brief Adapts a visitor into a member_callback.
+         *
+         * @param context The visitor.
+         * @param name    The name of the property.
+         * @param value   A pointer to the value of the property.
+         * @param type    The key of the type of the value.
+         */
+        template <typename F>
+        static void invoke_visitor(void* context, string_view name, const void* value, const void* type);
+
+    public:
+        //====================
+        // Ctors and dtor
+        //====================
+        /**
+         * @brief Constructor for a handle that does not refer to any object.
+         *
+         * Accessing members through the handle throws, except for the try_ methods, which report that
+         * the member variable was not found. Check it with is_valid first.
+         */
+        meta_object();
+
+        /**
+         * @brief Constructor for referencing an object of a registered class.
+         *
+         * The operations of the class are looked up once, so the meta_object can be stored in collections
+         * alongside objects of other classes. Nothing is allocated.
+         *
+         * @param object The object to reference, which must outlive the meta_object.
+         */
+        template <typename Class>
+        explicit meta_object(Class& object);
+
+        /**
+         * @brief Constructor for referencing an object whose type has been looked up at runtime, such as through the registry.
+         *
+         * @param object The object to reference, which must be of the class described by the type.
+         * @param type   The type of the object.
+         */
+        meta_object(void* object, const meta_type& type);
+
+        /**
+         * @brief Default destructor, which does not destroy the referenced object.
+         */
+        ~meta_object() = default;
+
+        //====================
+        // Getters and setters
+        //====================
+        /**
+         * @brief Checks whether the handle refers to an object.
+         *
+         * @returns True if an object is referenced.
+         */
+        bool is_valid() const;
+
+        /**
+         * @brief Retrieves the referenced object.
+         *
+         * @returns A pointer to the object.
+         */
+        void* get_object() const;
+
+        /**
+         * @brief Retrieves the type-erased operations of the class of the object.
+         *
+         * @returns The type of the object.
+         *
+         * @throws meta_exception If the handle does not refer to an object.
+         */
+        const meta_type& get_type() const;
+
+        /**
+         * @brief Retrieves the value of the named member variable, which may be a dotted path.
+         *
+         * @throws meta_exception If the member variable is not registered, or does not match the supplied datatype.
+         *
+         * @param name The name of the member variable.
+         *
+         * @returns A copy of the value.
+         */
+        template <typename T>
+        T get_member(string_view name) const;
+
+        /**
+         * @brief Retrieves the value of the member variable at the position.
+         *
+         * @throws meta_exception If the position is out of range, or the member variable does not match the supplied datatype.
+         *
+         * @param index The position of the member variable in registration order.
+         *
+         * @returns A copy of the value.
+         */
+        template <typename T>
+        T get_member_at(std::size_t index) const;
+
+        /**
+         * @brief Attempts to retrieve the value of the named member variable, without throwing.
+         *
+         * @param name  The name of the member variable.
+         * @param value The variable to copy the value into, which is left unchanged unless the member is found.
+         *
+         * @returns The outcome of the access.
+         */
+        template <typename T>
+        member_status try_get_member(string_view name, T& value) const;
+
+        /**
+         * @brief Sets the value of the named member variable, which may be a dotted path.
+         *
+         * @throws meta_exception If the member variable is not registered, does not match the supplied datatype, or is read-only.
+         *
+         * @param name  The name of the member variable.
+         * @param value The value to set.
+         */
+        template <typename T>
+        void set_member(string_view name, const T& value) const;
+
+        /**
+         * @brief Sets the value of the member variable at the position.
+         *
+         * @throws meta_exception If the position is out of range, the member variable does not match the supplied datatype, or is read-only.
+         *
+         * @param index The position of the member variable in registration order.
+         * @param value The value to set.
+         */
+        template <typename T>
+        void set_member_at(std::size_t index, const T& value) const;
+
+        /**
+         * @brief Attempts to set the value of the named member variable, without throwing.
+         *
+         * @param name  The name of the member variable.
+         * @param value The value to set.
+         *
+         * @returns The outcome of the access.
+         */
+        template <typename T>
+        member_status try_set_member(string_view name, const T& value) const;
+
+        /**
+         * @brief Retrieves a copy of the named member variable, whatever its datatype.
+         *
+         * Arithmetic types, enums and short strings are held within the returned value without allocating.
+         *
+         * @param name The name of the member variable.
+         *
+         * @returns The value of the member variable, or an empty value if it was not found.
+         */
+        value get_value(string_view name) const;
+
+        /**
+         * @brief Sets the named member variable to the held value, which must be of the exact datatype of the member.
+         *
+         * @param name  The name of the member variable.
+         * @param value The value to set.
+         *
+         * @throws meta_exception If the member variable is not found, is read-only or does not match the held datatype.
+         */
+        void set_value(string_view name, const value& value) const;
+
+        /**
+         * @brief Attempts to set the named member variable to the held value, without throwing.
+         *
+         * @param name  The name of the member variable.
+         * @param value The value to set.
+         *
+         * @returns The outcome of the access.
+         */
+        member_status try_set_value(string_view name, const value& value) const;
+
+        //====================
+        // Methods
+        //====================
+        /**
+         * @brief Invokes a visitor with the named member variable.
+         *
+         * The visitor is invoked with the name of the property, a pointer to its value, which is only valid
+         * during the call, and the key of its type, which can be compared against type_key().
+         *
+         * @param name The name of the member variable.
+         * @param f    The visitor.
+         *
+         * @returns True if the member variable was found.
+         */
+        template <typename F>
+        bool visit_member(string_view name, F&& f) const;
+
+        /**
+         * @brief Invokes a visitor with the member variable at the position. See visit_member().
+         *
+         * @param index The position of the member variable in registration order.
+         * @param f     The visitor.
+         *
+         * @returns True if the position is in range.
+         */
+        template <typename F>
+        bool visit_member_at(std::size_t index, F&& f) const;
+
+        /**
+         * @brief Invokes a visitor with every member variable, in registration order. See visit_member().
+         *
+         * @param f The visitor.
+         */
+        template <typename F>
+        void for_each(F&& f) const;
+    };
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "meta_object.inl" // Method declarations.
+
+#endif//_REFLECT_META_OBJECT_HPP_
\ No newline at end of file
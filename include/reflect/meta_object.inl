@@ -0,0 +1,239 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+namespace reflect
+{
+    //====================
+    // Ctors and dtor
+    //====================
+    /**********************************************************/
+    inline meta_object::meta_object()
+        : m_object(nullptr), m_type(nullptr)
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    meta_object::meta_object(Class& object)
+        : m_object(&object), m_type(&get_meta_type<Class>())
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    inline meta_object::meta_object(void* object, const meta_type& type)
+        : m_object(object), m_type(&type)
+    {
+        // Empty.
+    }
+
+    //====================
+    // Private methods
+    //====================
+    /**********************************************************/
+    inline void meta_object::throw_status(member_status status, string_view name)
+    {
+        std::string err = std::string("Member variable: ") + name.to_string();
+        switch (status)
+        {
+        case member_status::type_mismatch:
+            err += " does not match the supplied datatype.";
+            break;
+        case member_status::read_only:
+            err += " has no setters or member pointer set.";
+            break;
+        default:
+            err += " is not registered.";
+            break;
+        }
+
+        throw detail::meta_exception(err);
+    }
+
+    /**********************************************************/
+    inline const meta_type& meta_object::checked_type() const
+    {
+        if (!this->is_valid())
+        {
+            throw detail::meta_exception("Cannot access member variable: the meta object does not refer to an object.");
+        }
+
+        return *m_type;
+    }
+
+    /**********************************************************/
+    template <typename F>
+    void meta_object::invoke_visitor(void* context, string_view name, const void* value, const void* type)
+    {
+        (*static_cast<F*>(context))(name, value, type);
+    }
+
+    //====================
+    // Getters and setters
+    //====================
+    /**********************************************************/
+    inline bool meta_object::is_valid() const
+    {
+        return m_type != nullptr;
+    }
+
+    /**********************************************************/
+    inline void* meta_object::get_object() const
+    {
+        return m_object;
+    }
+
+    /**********************************************************/
+    inline const meta_type& meta_object::get_type() const
+    {
+        return this->checked_type();
+    }
+
+    /**********************************************************/
+    template <typename T>
+    T meta_object::get_member(string_view name) const
+    {
+        T value = T();
+
+        const member_status status = this->checked_type().get(m_object, name, &value, type_key<T>());
+        if (status != member_status::found)
+        {
+            throw_status(status, name);
+        }
+
+        return value;
+    }
+
+    /**********************************************************/
+    template <typename T>
+    T meta_object::get_member_at(std::size_t index) const
+    {
+        T value = T();
+
+        const member_status status = this->checked_type().get_at(m_object, index, &value, type_key<T>());
+        if (status != member_status::found)
+        {
+            throw_status(status, std::to_string(index));
+        }
+
+        return value;
+    }
+
+    /**********************************************************/
+    template <typename T>
+    member_status meta_object::try_get_member(string_view name, T& value) const
+    {
+        if (!this->is_valid())
+        {
+            return member_status::not_found;
+        }
+
+        return m_type->get(m_object, name, &value, type_key<T>());
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void meta_object::set_member(string_view name, const T& value) const
+    {
+        const member_status status = this->checked_type().set(m_object, name, &value, type_key<T>());
+        if (status != member_status::found)
+        {
+            throw_status(status, name);
+        }
+    }
+
+    /**********************************************************/
+    template <typename T>
+    void meta_object::set_member_at(std::size_t index, const T& value) const
+    {
+        const member_status status = this->checked_type().set_at(m_object, index, &value, type_key<T>());
+        if (status != member_status::found)
+        {
+            throw_status(status, std::to_string(index));
+        }
+    }
+
+    /**********************************************************/
+    template <typename T>
+    member_status meta_object::try_set_member(string_view name, const T& value) const
+    {
+        if (!this->is_valid())
+        {
+            return member_status::not_found;
+        }
+
+        return m_type->set(m_object, name, &value, type_key<T>());
+    }
+
+    /**********************************************************/
+    inline value meta_object::get_value(string_view name) const
+    {
+        return this->checked_type().get_value(m_object, name);
+    }
+
+    /**********************************************************/
+    inline void meta_object::set_value(string_view name, const value& value) const
+    {
+        const member_status status = this->try_set_value(name, value);
+        if (status != member_status::found)
+        {
+            throw_status(status, name);
+        }
+    }
+
+    /**********************************************************/
+    inline member_status meta_object::try_set_value(string_view name, const value& value) const
+    {
+        if (!this->is_valid())
+        {
+            return member_status::not_found;
+        }
+
+        return m_type->set(m_object, name, value.data(), value.type());
+    }
+
+    //====================
+    // Methods
+    //====================
+    /**********************************************************/
+    template <typename F>
+    bool meta_object::visit_member(string_view name, F&& f) const
+    {
+        return this->checked_type().visit(m_object, name, const_cast<void*>(static_cast<const void*>(&f)), &invoke_visitor<std::remove_reference_t<F>>) == member_status::found;
+    }
+
+    /**********************************************************/
+    template <typename F>
+    bool meta_object::visit_member_at(std::size_t index, F&& f) const
+    {
+        return this->checked_type().visit_at(m_object, index, const_cast<void*>(static_cast<const void*>(&f)), &invoke_visitor<std::remove_reference_t<F>>) == member_status::found;
+    }
+
+    /**********************************************************/
+    template <typename F>
+    void meta_object::for_each(F&& f) const
+    {
+        this->checked_type().for_each(m_object, const_cast<void*>(static_cast<const void*>(&f)), &invoke_visitor<std::remove_reference_t<F>>);
+    }
+
+} // namespace reflect
\ No newline at end of file
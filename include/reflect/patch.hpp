@@ -0,0 +1,182 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_PATCH_HPP_
+#define _REFLECT_PATCH_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef> // Sizes of the encoded changes.
+#include <cstdint> // Encoding the positions of changed properties.
+#include <utility> // Taking ownership of encoded changes.
+#include <vector>  // Storing the encoded changes.
+
+//====================
+// Reflect includes
+//====================
+#include "meta_class.hpp"     // Iterating the registered properties.
+#include "algorithms.hpp"     // Comparing the values of properties.
+#include "binary_archive.hpp" // Encoding the values of changed properties.
+
+namespace reflect
+{
+    //====================
+    // Functions
+    //====================
+    /**
+     * @brief Compares two objects property by property, recording the properties which have changed.
+     *
+     * Properties are compared through their getters, stopping at the first difference for arithmetic
+     * values; nested classes that can be compared as bytes are compared as the byte ranges of their
+     * members. Read-only properties are not compared, as they cannot be applied.
+     *
+     * @param before The object to compare against.
+     * @param after  The object whose changed values are recorded.
+     *
+     * @returns A patch holding the positions and new values of the changed properties.
+     */
+    template <typename Class>
+    patch<Class> diff(const Class& before, const Class& after);
+
+    /**
+     * @brief Writes the changed values of a patch into an object through the setters of its properties.
+     *
+     * @param changes The patch to replay.
+     * @param object  The object to write to.
+     *
+     * @throws meta_exception If the patch was created for a different schema, or is malformed, in which case the object is left unchanged.
+     */
+    template <typename Class>
+    void apply(const patch<Class>& changes, Class& object);
+
+    template <typename Class>
+    class patch final
+    {
+        friend patch diff<Class>(const Class& before, const Class& after);
+        friend void apply<Class>(const patch& changes, Class& object);
+
+    private:
+        //====================
+        // Member variables
+        //====================
+        /** The schema fingerprint of the class, followed by the position and value of each changed property. */
+        std::vector<char> m_bytes;
+
+        //====================
+        // Private methods
+        //====================
+        /**
+         * @brief Constructor for taking ownership of encoded changes.
+         *
+         * @param bytes The encoded changes.
+         */
+        explicit patch(std::vector<char>&& bytes);
+
+        /**
+         * @brief Creates a patch holding the properties which differ between two objects.
+         *
+         * @param before The object to compare against.
+         * @param after  The object whose changed values are recorded.
+         *
+         * @returns The patch of changes.
+         */
+        static patch create(const Class& before, const Class& after);
+
+        /**
+         * @brief Writes each changed value into the object, once the whole patch has been validated.
+         *
+         * @param object The object to write to.
+         *
+         * @throws meta_exception If the patch is malformed, in which case the object is left unchanged.
+         */
+        void apply_to(Class& object) const;
+
+        /**
+         * @brief Decodes each changed value, writing it into the object if one is supplied.
+         *
+         * @param object The object to write to, or a null pointer to only validate the patch.
+         *
+         * @throws meta_exception If the patch is malformed, or refers to a property that cannot be set.
+         */
+        void read_changes(Class* object) const;
+
+    public:
+        //====================
+        // Ctors and dtor
+        //====================
+        /**
+         * @brief Constructor for creating a patch without any changes.
+         */
+        patch();
+
+        /**
+         * @brief Constructor for a patch that has been received as bytes, such as from another process.
+         *
+         * The bytes are copied, and are validated when the patch is applied.
+         *
+         * @param data The first byte of the patch.
+         * @param size The number of bytes within the patch.
+         */
+        explicit patch(const char* data, std::size_t size);
+
+        /**
+         * @brief Default destructor.
+         */
+        ~patch() = default;
+
+        //====================
+        // Getters and setters
+        //====================
+        /**
+         * @brief Retrieves the encoded changes, which can be sent elsewhere and reconstructed.
+         *
+         * The changes are encoded as the schema fingerprint of the class, followed by the 32-bit position
+         * of each changed property and its value in the format of a binary archive.
+         *
+         * @returns A pointer to the encoded changes.
+         */
+        const char* data() const;
+
+        /**
+         * @brief Retrieves the number of bytes of the encoded changes.
+         *
+         * @returns The size of the patch.
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief Checks whether the patch records any changed properties.
+         *
+         * @returns True if no properties have changed.
+         */
+        bool empty() const;
+    };
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "patch.inl" // Method declarations.
+
+#endif//_REFLECT_PATCH_HPP_
\ No newline at end of file
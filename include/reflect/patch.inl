@@ -0,0 +1,187 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+namespace reflect
+{
+    //====================
+    // Ctors and dtor
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    patch<Class>::patch()
+        : m_bytes()
+    {
+        binary_writer writer;
+        writer.write_value(schema_fingerprint<Class>());
+
+        m_bytes.assign(writer.data(), writer.data() + writer.size());
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    patch<Class>::patch(const char* data, std::size_t size)
+        : m_bytes(data, data + size)
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    patch<Class>::patch(std::vector<char>&& bytes)
+        : m_bytes(std::move(bytes))
+    {
+        // Empty.
+    }
+
+    //====================
+    // Private methods
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    patch<Class> patch<Class>::create(const Class& before, const Class& after)
+    {
+        // Most patches hold a few changed values, which then fit without growing the buffer.
+        binary_writer writer;
+        writer.reserve(64);
+        writer.write_value(schema_fingerprint<Class>());
+
+        std::uint32_t position = 0;
+        detail::for_tuple([&before, &after, &writer, &position](const auto& member) {
+            if (member.has_setter() || member.has_member())
+            {
+                const bool equal = member.visit(before, [&member, &after](const auto& left) {
+                    return member.visit(after, [&left](const auto& right) {
+                        return detail::equal_values(left, right);
+                    });
+                });
+
+                if (!equal)
+                {
+                    writer.write_value(position);
+                    member.visit(after, [&writer](const auto& value) {
+                        writer.write_value(value);
+                    });
+                }
+            }
+
+            ++position;
+        }, get_members<Class>());
+
+        // The buffer of the writer is only grown, so it is trimmed to the written bytes before being taken.
+        writer.m_buffer.resize(writer.m_size);
+        return patch(std::move(writer.m_buffer));
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    void patch<Class>::apply_to(Class& object) const
+    {
+        // Every change is decoded before any is applied, so that a malformed patch leaves the object untouched.
+        this->read_changes(nullptr);
+        this->read_changes(&object);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    void patch<Class>::read_changes(Class* object) const
+    {
+        binary_reader reader(m_bytes.data(), m_bytes.size());
+
+        std::uint64_t fingerprint = 0;
+        reader.read_value(fingerprint);
+        if (fingerprint != schema_fingerprint<Class>())
+        {
+            throw detail::meta_exception("Cannot apply patch: the patch was created with a different schema.");
+        }
+
+        const auto& members = get_members<Class>();
+        while (!reader.at_end())
+        {
+            std::uint32_t position = 0;
+            reader.read_value(position);
+            if (position >= std::tuple_size<std::decay_t<decltype(members)>>::value)
+            {
+                throw detail::meta_exception("Cannot apply patch: the patch refers to a property that is not registered.");
+            }
+
+            detail::for_tuple_at<void>(position, [&reader, object](const auto& member) {
+                using member_type = std::decay_t<typename std::decay_t<decltype(member)>::member_type>;
+
+                if (!member.has_setter() && !member.has_member())
+                {
+                    throw detail::meta_exception("Cannot apply patch: the patch refers to a property that cannot be set.");
+                }
+
+                member_type value = member_type();
+                reader.read_value(value);
+                if (object != nullptr)
+                {
+                    member.set(*object, std::move(value));
+                }
+            }, members);
+        }
+    }
+
+    //====================
+    // Getters and setters
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    const char* patch<Class>::data() const
+    {
+        return m_bytes.data();
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    std::size_t patch<Class>::size() const
+    {
+        return m_bytes.size();
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    bool patch<Class>::empty() const
+    {
+        return m_bytes.size() <= sizeof(std::uint64_t);
+    }
+
+    //====================
+    // Functions
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    patch<Class> diff(const Class& before, const Class& after)
+    {
+        static_assert(is_registered<Class>(), "Only registered classes can be compared.");
+        return patch<Class>::create(before, after);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    void apply(const patch<Class>& changes, Class& object)
+    {
+        static_assert(is_registered<Class>(), "Only registered classes can be patched.");
+        changes.apply_to(object);
+    }
+
+} // namespace reflect
\ No newline at end of file
@@ -26,14 +26,31 @@
 //====================
 // C++ includes
 //====================
-#include <string>        // Represents the name of the property.
-#include <unordered_map> // Creating a map of enumerated types.
+#include <string>      // Represents the name of the property.
+#include <type_traits> // Rejecting temporary names.
+
+//====================
+// Reflect includes
+//====================
+#include "string_view.hpp" // Represents the name of the property.
 
 namespace reflect
 {
-    // Forward declare the enum property for conversion purposes.
-    template<typename Class, typename T>
-    class enum_property_impl;
+    namespace detail
+    {
+        // Forward declare the accessors that bind a property to a class.
+        template <typename Class, typename T>
+        class member_accessor;
+
+        template <typename Class, typename T, typename Getter>
+        class readonly_accessor;
+
+        template <typename Class, typename T, typename Getter, typename Setter>
+        class function_accessor;
+
+        template <typename Class, typename T>
+        class dynamic_accessor;
+    }
 
     //====================
     // Aliases
@@ -58,11 +75,21 @@ namespace reflect
     template <typename Class, typename T>
     using val_setter_func_ptr = void (Class::*)(T);
 
+    /** Alias for a setter method which takes in an object argument by rvalue reference. */
+    template <typename Class, typename T>
+    using rval_setter_func_ptr = void (Class::*)(T&&);
+
     /** Specifies the type of the member variable. */
     template <typename Type>
     using get_member_type = typename std::decay_t<Type>::member_type;
     
-    template <typename Class, typename T>
+    /**
+     * The accessor determines how the property reaches the data of the class. The accessors
+     * created by the property functions encode the kind of access (member pointer, getter, or getter and setter)
+     * within their type, so that getting and setting the value is a direct call with no checks. The default
+     * accessor stores every kind of function pointer and selects between them at runtime.
+     */
+    template <typename Class, typename T, typename Accessor = detail::dynamic_accessor<Class, T>>
     class property_impl
     {
     private:
@@ -70,23 +97,14 @@ namespace reflect
         // Member variables
         //====================
         /** The name of the property, which is the name of the value when serialized. */
-        std::string                   m_name;
-        /** A function pointer for a member variable of a class. */
-        member_ptr<Class, T>          m_member;
-        /** Whether the property_impl object has a member variable pointer. */
-        bool                          m_has_member;
-        /** A function pointer for a getter method that returns a reference. */
-        ref_getter_func_ptr<Class, T> m_ref_getter;
-        /** A function pointer for a setter method that takes in a referenced argument. */
-        ref_setter_func_ptr<Class, T> m_ref_setter;
-        /** A function pointer for a getter method that returns an object by value. */
-        val_getter_func_ptr<Class, T> m_val_getter;
-        /** A function pointer for a setter method that takes in an argument by value. */
-        val_setter_func_ptr<Class, T> m_val_setter;
+        string_view m_name;
+        /** Binds the property to the member variable, or the getters and setters of the class. */
+        Accessor    m_accessor;
 
     public:
         using class_type = Class;
         using member_type = T;
+        using accessor_type = Accessor;
 
         //====================
         // Ctors and dtor
@@ -100,68 +118,38 @@ namespace reflect
         explicit property_impl() = delete;
 
         /**
-         * @brief Constructor for creating a new property_impl object with a member variable functor.
-         * 
-         * When this constructor is invoked, it will create a new property_impl object that binds the member
-         * variable of a class for getting and setting when invoked by the meta engine.
-         * 
-         * @param name   The name of the property when serialized.
-         * @param member The member variable to bind to the property.
-         */
-        explicit property_impl(const std::string& name, member_ptr<Class, T> member);
-
-        /**
-         * @brief Constructor for creating a new property_impl object with a getter and setter which uses referenced values.
+         * @brief Constructor for creating a new property_impl object.
          * 
-         * When this constructor is invoked, it will create a new property_impl object that binds the getter and
-         * setter of a class that utilises return values and arguments that are referred to by reference.
+         * When this constructor is invoked, the member variable pointer, or the getter and setter
+         * function pointers, are passed to the accessor to bind the property to the class for getting
+         * and setting when invoked by the meta engine. The name is not copied, so it should be a string
+         * literal or otherwise outlive the property; this keeps registration free of allocations.
          * 
-         * @param name   The name of the property when serialized.
-         * @param getter The getter function to bind.
-         * @param setter The setter function to bind.
+         * @param name      The name of the property when serialized.
+         * @param accessors The member variable or getter and setter functions to bind to the property.
          */
-        explicit property_impl(const std::string& name, ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
-
-        /**
-         * @brief Constructor for creating a new property_impl object with a getter and setter which uses object values.
-         * 
-         * When this constructor is invoked, it will create a new property_impl object that binds the getter and
-         * setter of a class that utilises return values and arguments that are referred to by reference.
-         * 
-         * @param name   The name of the property when serialized.
-         * @param getter The getter function to bind.
-         * @param setter The setter function to bind.
-         */
-        explicit property_impl(const std::string& name, val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter);
-
-        /**
-         * @brief Constructor for creating a new property_impl object with a getter and setter which uses referenced or object values.
-         * 
-         * When this constructor is invoked, it will create a new property_impl object that binds the getter and
-         * setter of a class that utilises return values and arguments that are either referenced of by value.
-         * 
-         * @param name   The name of the property when serialized.
-         * @param getter The getter function to bind.
-         * @param setter The setter function to bind.
-         */
-        explicit property_impl(const std::string& name, val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
+        template <typename... Ptrs>
+        constexpr explicit property_impl(string_view name, Ptrs... accessors);
 
         /**
          * @brief Default destructor for the propert_impl object.
          */
-        virtual ~property_impl() = default;
+        ~property_impl() = default;
         
         //====================
         // Getters and setters
         //====================
         /**
-         * @brief Retrieves a constant reference of the variable registered with this property.
+         * @brief Retrieves the variable registered with this property.
+         * 
+         * The variable is returned by constant reference if it is bound with a member pointer or a
+         * getter which returns a reference, otherwise it is returned by value.
          * 
          * @param obj The object instance to return the data from.
          * 
-         * @returns A constant reference to the underlying mapped data.
+         * @returns The underlying mapped data.
          */
-        const T& get(const Class& obj) const;
+        typename Accessor::get_type get(const Class& obj) const;
 
         /**
          * @brief Retrieves a copy of the variable registered with this property.
@@ -172,6 +160,21 @@ namespace reflect
          */
         T get_copy(const Class& obj) const;
 
+        /**
+         * @brief Invokes the function with the variable registered with this property.
+         * 
+         * The function receives a constant reference if the property is bound with a member pointer
+         * or a getter which returns a reference, otherwise it receives the value returned by the getter.
+         * No copy is made of the variable, and the value returned by a getter lives until the function returns.
+         * 
+         * @param obj The object instance to return the data from.
+         * @param f   The function to invoke with the data.
+         * 
+         * @returns The result of the invoked function.
+         */
+        template <typename F>
+        decltype(auto) visit(const Class& obj, F&& f) const;
+
         /**
          * @brief Retrieves a reference of the variable registered with this property.
          * 
@@ -212,7 +215,7 @@ namespace reflect
          * 
          * @returns The name of the property object.
          */      
-        const std::string& get_name() const;
+        constexpr string_view get_name() const;
 
         /**
          * @brief Checks whether a member function pointer has been registered with the property.
@@ -267,21 +270,6 @@ namespace reflect
          * @returns True if the property_impl object is exposing an enumerated type.
          */
         bool is_enum() const;
-
-        //====================
-        // Methods
-        //====================
-        /**
-         * @brief Converts the property_impl object into a enum_property_impl object.
-         * 
-         * When the property_impl is cast to the enum property, if the property object is not
-         * registered as an enum, it will throw an exception.
-         * 
-         * @returns A new enum_property_impl object.
-         * 
-         * @throws meta_exception is the property does not use a registered enumerated type.
-         */
-        enum_property_impl<Class, T> as_enum() const;
     };
 
     //====================
@@ -292,7 +280,7 @@ namespace reflect
      * 
      * These functions are used to quickly bind properties on a class, without having to insert the template
      * types when creating property_impl objects. They should only be invoked when registering a new class to the
-     * meta-engine.
+     * meta-engine. The name is not copied, so it should be a string literal.
      * 
      * @param name   The name of the property when serialized.
      * @param member The member variable to bind to the property.
@@ -300,7 +288,7 @@ namespace reflect
      * @returns A new property_impl object with a bound member variable functor.
      */
     template <typename Class, typename T>
-    property_impl<Class, T> property(const std::string& name, member_ptr<Class, T> member);
+    constexpr property_impl<Class, T, detail::member_accessor<Class, T>> property(string_view name, member_ptr<Class, T> member);
 
     /**
     * @brief Convenience method for creating a new property_impl object with reference getter.
@@ -319,7 +307,7 @@ namespace reflect
     * @throws runtime_error If the property is attempting to set the value.
     */
     template <typename Class, typename T>
-    property_impl<Class, T> property(const std::string& name, ref_getter_func_ptr<Class, T> getter);
+    constexpr property_impl<Class, T, detail::readonly_accessor<Class, T, ref_getter_func_ptr<Class, T>>> property(string_view name, ref_getter_func_ptr<Class, T> getter);
 
     /**
     * @brief Convenience method for creating a new property_impl object with by value getter.
@@ -338,7 +326,7 @@ namespace reflect
     * @throws runtime_error If the property is attempting to set the value.
     */
     template <typename Class, typename T>
-    property_impl<Class, T> property(const std::string& name, val_getter_func_ptr<Class, T> getter);
+    constexpr property_impl<Class, T, detail::readonly_accessor<Class, T, val_getter_func_ptr<Class, T>>> property(string_view name, val_getter_func_ptr<Class, T> getter);
 
     /**
      * @brief Convenience method for creating a new property_impl object with reference getters and setters.
@@ -354,7 +342,7 @@ namespace reflect
      * @returns A new property_impl object with a bound referenced getter and setter functors.
      */
     template <typename Class, typename T>
-    property_impl<Class, T> property(const std::string& name, ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
+    constexpr property_impl<Class, T, detail::function_accessor<Class, T, ref_getter_func_ptr<Class, T>, ref_setter_func_ptr<Class, T>>> property(string_view name, ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
 
     /**
      * @brief Convenience method for creating a new property_impl object with by value getters and setters.
@@ -370,7 +358,7 @@ namespace reflect
      * @returns A new property_impl object with a bound value based getter and setter functors.
      */
     template <typename Class, typename T>
-    property_impl<Class, T> property(const std::string& name, val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter);
+    constexpr property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, val_setter_func_ptr<Class, T>>> property(string_view name, val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter);
 
     /**
      * @brief Convenience method for creating a new property_impl object with a value getter and a setter which takes a referenced parameter.
@@ -386,13 +374,56 @@ namespace reflect
      * @returns A new property_impl object with a bound value-based getter and reference-based setter functors.
      */
     template <typename Class, typename T>
-    property_impl<Class, T> property(const std::string& name, val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
+    constexpr property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, ref_setter_func_ptr<Class, T>>> property(string_view name, val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter);
+
+    /**
+     * @brief Convenience method for creating a new property_impl object with a reference getter and a setter which takes an rvalue parameter.
+     * 
+     * These functions are used to quickly bind properties on a class, without having to insert the template
+     * types when creating property_impl objects. They should only be invoked when registering a new class to the
+     * meta-engine. Values set through the property are moved into the setter where possible.
+     * 
+     * @param name   The name of the property when serialized.
+     * @param getter The getter method functor which returns an object by reference.
+     * @param setter The setter method functor which takes an object by rvalue reference for an argument.
+     * 
+     * @returns A new property_impl object with a bound reference-based getter and rvalue-based setter functors.
+     */
+    template <typename Class, typename T>
+    constexpr property_impl<Class, T, detail::function_accessor<Class, T, ref_getter_func_ptr<Class, T>, rval_setter_func_ptr<Class, T>>> property(string_view name, ref_getter_func_ptr<Class, T> getter, rval_setter_func_ptr<Class, T> setter);
+
+    /**
+     * @brief Convenience method for creating a new property_impl object with a value getter and a setter which takes an rvalue parameter.
+     * 
+     * These functions are used to quickly bind properties on a class, without having to insert the template
+     * types when creating property_impl objects. They should only be invoked when registering a new class to the
+     * meta-engine. Values set through the property are moved into the setter where possible.
+     * 
+     * @param name   The name of the property when serialized.
+     * @param getter The getter method functor which returns an object by value.
+     * @param setter The setter method functor which takes an object by rvalue reference for an argument.
+     * 
+     * @returns A new property_impl object with a bound value-based getter and rvalue-based setter functors.
+     */
+    template <typename Class, typename T>
+    constexpr property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, rval_setter_func_ptr<Class, T>>> property(string_view name, val_getter_func_ptr<Class, T> getter, rval_setter_func_ptr<Class, T> setter);
+
+    /**
+     * @brief Deleted overload that rejects temporary strings as property names.
+     *
+     * Property names are viewed rather than copied, and registered properties are kept for the lifetime of
+     * the program, so names must have static storage duration, such as string literals. A temporary string
+     * would be destroyed as soon as the property had been created, leaving its name dangling.
+     */
+    template <typename S, typename... Args, typename = std::enable_if_t<std::is_same<S, std::string>::value>>
+    void property(S&& name, Args&&... args) = delete;
 
 } // namespace reflect
 
 //====================
 // Reflect includes
 //====================
-#include "property.inl" // Method declarations.
+#include "detail/accessors.hpp" // Binding properties to classes.
+#include "property.inl"          // Method declarations.
 
 #endif//_REFLECT_PROPERTY_HPP_
\ No newline at end of file
@@ -31,33 +31,10 @@ namespace reflect
     // Ctors and dtor
     //====================
     /**********************************************************/
-    template <typename Class, typename T>
-    property_impl<Class, T>::property_impl(const std::string& name, member_ptr<Class, T> member) 
-        : m_name(name), m_member(member), m_has_member(true), m_ref_getter(nullptr), m_ref_setter(nullptr), m_val_getter(nullptr), m_val_setter(nullptr)
-    { 
-        // Empty.
-    }
-
-    /**********************************************************/
-    template <typename Class, typename T>
-    property_impl<Class, T>::property_impl(const std::string& name, ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter) 
-        : m_name(name), m_member(nullptr), m_has_member(false), m_ref_getter(getter), m_ref_setter(setter), m_val_getter(nullptr), m_val_setter(nullptr)
-    {
-        // Empty.
-    }
-
-    /**********************************************************/
-    template <typename Class, typename T>
-    property_impl<Class, T>::property_impl(const std::string& name, val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter) 
-        : m_name(name), m_member(nullptr), m_has_member(false), m_ref_getter(nullptr), m_ref_setter(nullptr), m_val_getter(getter), m_val_setter(setter)
-    { 
-        // Empty.
-    }
-
-    /**********************************************************/
-    template <typename Class, typename T>
-    property_impl<Class, T>::property_impl(const std::string& name, val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter) 
-        : m_name(name), m_member(nullptr), m_has_member(false), m_ref_getter(nullptr), m_ref_setter(setter), m_val_getter(getter), m_val_setter(nullptr)
+    template <typename Class, typename T, typename Accessor>
+    template <typename... Ptrs>
+    constexpr property_impl<Class, T, Accessor>::property_impl(string_view name, Ptrs... accessors) 
+        : m_name(name), m_accessor(accessors...)
     { 
         // Empty.
     }
@@ -66,191 +43,148 @@ namespace reflect
     // Getters and setters
     //====================
     /**********************************************************/
-    template <typename Class, typename T>
-    const T& property_impl<Class, T>::get(const Class& obj) const
+    template <typename Class, typename T, typename Accessor>
+    typename Accessor::get_type property_impl<Class, T, Accessor>::get(const Class& obj) const
     {
-        if (m_ref_getter) 
-        {
-            return (obj.*m_ref_getter)();
-        } 
-        else if (m_val_getter)
-        {
-            return (obj.*m_val_getter)();
-        }
-        else if (m_has_member) 
-        {
-            return obj.*m_member;
-        }
-
-        throw detail::meta_exception("Cannot return const reference to member variable: no getter function or member pointer set.");
+        return m_accessor.get(obj);
     }
 
     /**********************************************************/
-    template <typename Class, typename T>
-    T property_impl<Class, T>::get_copy(const Class& obj) const
+    template <typename Class, typename T, typename Accessor>
+    T property_impl<Class, T, Accessor>::get_copy(const Class& obj) const
     {
-        if (m_val_getter)
-        {
-            return (obj.*m_val_getter)();
-        } 
-        else if (m_ref_getter) 
-        {
-            return (obj.*m_ref_getter)();
-        } 
-        else if (this->has_member()) 
-        {
-            return obj.*m_member;
-        }
-
-        throw detail::meta_exception("Cannot return copy of member variable: no getter function or member pointer set.");
+        return m_accessor.get_copy(obj);
     }
 
     /**********************************************************/
-    template <typename Class, typename T>
-    T& property_impl<Class, T>::get_reference(Class& obj) const
+    template <typename Class, typename T, typename Accessor>
+    template <typename F>
+    decltype(auto) property_impl<Class, T, Accessor>::visit(const Class& obj, F&& f) const
     {
-        if(this->has_member()) 
-        {
-            return obj.*m_member;
-        }
-
-        throw detail::meta_exception("Cannot return reference of member variable: no member pointer set.");
+        return m_accessor.visit(obj, std::forward<F>(f));
     }
 
     /**********************************************************/
-    template <typename Class, typename T>
-    member_ptr<Class, T> property_impl<Class, T>::get_member() const {
-        if (this->has_member()) 
-        {
-            return m_member;
-        }
+    template <typename Class, typename T, typename Accessor>
+    T& property_impl<Class, T, Accessor>::get_reference(Class& obj) const
+    {
+        return m_accessor.get_reference(obj);
+    }
 
-        throw detail::meta_exception("Cannot retrieve pointer to member variable: no member pointer set.");
+    /**********************************************************/
+    template <typename Class, typename T, typename Accessor>
+    member_ptr<Class, T> property_impl<Class, T, Accessor>::get_member() const 
+    {
+        return m_accessor.get_member();
     }
 
     /**********************************************************/
-    template<typename Class, typename T>
+    template <typename Class, typename T, typename Accessor>
     template <typename V, typename>
-    void property_impl<Class, T>::set(Class& obj, V&& value) const
+    void property_impl<Class, T, Accessor>::set(Class& obj, V&& value) const
     {
-        if (m_ref_setter) 
-        {
-            (obj.*m_ref_setter)(value);
-        } 
-        else if (m_val_setter) 
-        {
-            (obj.*m_val_setter)(value);
-        } 
-        else if (this->has_member()) 
-        {
-            obj.*m_member = value;
-        }
-        else
-        {
-            throw detail::meta_exception("Cannot set value: no setters or member pointer set.");
-        }
+        m_accessor.set(obj, std::forward<V>(value));
     }
 
     /**********************************************************/
-    template<typename Class, typename T>
-    const std::string& property_impl<Class, T>::get_name() const
+    template <typename Class, typename T, typename Accessor>
+    constexpr string_view property_impl<Class, T, Accessor>::get_name() const
     {
         return m_name;
     }
 
     /**********************************************************/
-    template<typename Class, typename T>
-    bool property_impl<Class, T>::has_member() const
+    template <typename Class, typename T, typename Accessor>
+    bool property_impl<Class, T, Accessor>::has_member() const
     {
-        return m_has_member || m_member; 
+        return m_accessor.has_member(); 
     }
 
     /**********************************************************/
-    template <typename Class, typename T>
-    bool property_impl<Class, T>::has_getter() const
+    template <typename Class, typename T, typename Accessor>
+    bool property_impl<Class, T, Accessor>::has_getter() const
     {
-        return m_ref_getter || m_val_getter;
+        return m_accessor.has_getter();
     }
 
     /**********************************************************/
-    template <typename Class, typename T>
-    bool property_impl<Class, T>::has_setter() const
+    template <typename Class, typename T, typename Accessor>
+    bool property_impl<Class, T, Accessor>::has_setter() const
     {
-        return m_ref_setter || m_val_setter;
+        return m_accessor.has_setter();
     }
 
     /**********************************************************/
-    template <typename Class, typename T>
-    bool property_impl<Class, T>::can_get_const_ref() const
+    template <typename Class, typename T, typename Accessor>
+    bool property_impl<Class, T, Accessor>::can_get_const_ref() const
     {
-        return m_has_member || m_ref_getter;
+        return m_accessor.can_get_const_ref();
     }
 
     /**********************************************************/
-    template <typename Class, typename T>
-    bool property_impl<Class, T>::is_enum() const
+    template <typename Class, typename T, typename Accessor>
+    bool property_impl<Class, T, Accessor>::is_enum() const
     {
         return std::is_enum<T>::value;
     }
 
     //====================
-    // Methods
+    // Functions
     //====================
     /**********************************************************/
     template <typename Class, typename T>
-    enum_property_impl<Class, T> property_impl<Class, T>::as_enum() const
+    constexpr property_impl<Class, T, detail::member_accessor<Class, T>> property(string_view name, member_ptr<Class, T> member)
     {
-        if (!this->is_enum())
-        {
-            throw detail::meta_exception("Property is not registered to an enumerated type.");
-        }
+        return property_impl<Class, T, detail::member_accessor<Class, T>>(name, member);
+    }
 
-        return static_cast<const enum_property_impl<Class, T>&>(*this);
+    /**********************************************************/
+    template <typename Class, typename T>
+    constexpr property_impl<Class, T, detail::readonly_accessor<Class, T, ref_getter_func_ptr<Class, T>>> property(string_view name, ref_getter_func_ptr<Class, T> getter)
+    {
+        return property_impl<Class, T, detail::readonly_accessor<Class, T, ref_getter_func_ptr<Class, T>>>(name, getter);
     }
 
-    //====================
-    // Functions
-    //====================
     /**********************************************************/
     template <typename Class, typename T>
-    property_impl<Class, T> property(const std::string& name, member_ptr<Class, T> member)
+    constexpr property_impl<Class, T, detail::readonly_accessor<Class, T, val_getter_func_ptr<Class, T>>> property(string_view name, val_getter_func_ptr<Class, T> getter)
     {
-        return property_impl<Class, T>(name, member);
+        return property_impl<Class, T, detail::readonly_accessor<Class, T, val_getter_func_ptr<Class, T>>>(name, getter);
     }
 
     /**********************************************************/
     template <typename Class, typename T>
-    property_impl<Class, T> property(const std::string& name, ref_getter_func_ptr<Class, T> getter)
+    constexpr property_impl<Class, T, detail::function_accessor<Class, T, ref_getter_func_ptr<Class, T>, ref_setter_func_ptr<Class, T>>> property(string_view name, ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter)
     {
-        return property_impl<Class, T>(name, getter, ref_setter_func_ptr<Class, T>(nullptr));
+        return property_impl<Class, T, detail::function_accessor<Class, T, ref_getter_func_ptr<Class, T>, ref_setter_func_ptr<Class, T>>>(name, getter, setter);
     }
 
     /**********************************************************/
     template <typename Class, typename T>
-    property_impl<Class, T> property(const std::string& name, val_getter_func_ptr<Class, T> getter)
+    constexpr property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, val_setter_func_ptr<Class, T>>> property(string_view name, val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter)
     {
-        return property_impl<Class, T>(name, getter, val_setter_func_ptr<Class, T>(nullptr));
+        return property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, val_setter_func_ptr<Class, T>>>(name, getter, setter);
     }
 
     /**********************************************************/
     template <typename Class, typename T>
-    property_impl<Class, T> property(const std::string& name, ref_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter)
+    constexpr property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, ref_setter_func_ptr<Class, T>>> property(string_view name, val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter)
     {
-        return property_impl<Class, T>(name, getter, setter);
+        return property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, ref_setter_func_ptr<Class, T>>>(name, getter, setter);
     }
 
     /**********************************************************/
     template <typename Class, typename T>
-    property_impl<Class, T> property(const std::string& name, val_getter_func_ptr<Class, T> getter, val_setter_func_ptr<Class, T> setter)
+    constexpr property_impl<Class, T, detail::function_accessor<Class, T, ref_getter_func_ptr<Class, T>, rval_setter_func_ptr<Class, T>>> property(string_view name, ref_getter_func_ptr<Class, T> getter, rval_setter_func_ptr<Class, T> setter)
     {
-        return property_impl<Class, T>(name, getter, setter);
+        return property_impl<Class, T, detail::function_accessor<Class, T, ref_getter_func_ptr<Class, T>, rval_setter_func_ptr<Class, T>>>(name, getter, setter);
     }
 
     /**********************************************************/
     template <typename Class, typename T>
-    property_impl<Class, T> property(const std::string& name, val_getter_func_ptr<Class, T> getter, ref_setter_func_ptr<Class, T> setter)
+    constexpr property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, rval_setter_func_ptr<Class, T>>> property(string_view name, val_getter_func_ptr<Class, T> getter, rval_setter_func_ptr<Class, T> setter)
     {
-        return property_impl<Class, T>(name, getter, setter);
+        return property_impl<Class, T, detail::function_accessor<Class, T, val_getter_func_ptr<Class, T>, rval_setter_func_ptr<Class, T>>>(name, getter, setter);
     }
 
 } // end of namespace reflect
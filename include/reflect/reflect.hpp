@@ -26,8 +26,11 @@
 //====================
 // Reflect includes
 //====================
+#include "string_view.hpp"   // Naming properties.
 #include "property.hpp"      // Creating properties.
 #include "enum_property.hpp" // Creating enumerated properties.
 #include "meta_class.hpp"    // Manipulating meta-data.
+#include "member_handle.hpp" // Resolving members ahead of time.
+#include "member_status.hpp" // Reporting the outcome of non-throwing accesses.
 
 #endif//_REFLECT_HPP_
\ No newline at end of file
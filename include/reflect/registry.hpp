@@ -0,0 +1,285 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_REGISTRY_HPP_
+#define _REFLECT_REGISTRY_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef>       // Positions of the properties.
+#include <cstdint>       // Stable type identifiers.
+#include <string>        // Storing the registered names.
+#include <type_traits>   // Selecting the operations supported by each class.
+#include <unordered_map> // Looking up types by identifier.
+
+//====================
+// Reflect includes
+//====================
+#include "string_view.hpp"           // Looking up types by name.
+#include "meta_class.hpp"            // Iterating the registered properties.
+#include "member_status.hpp"         // Reporting the outcome of type-erased accesses.
+#include "value.hpp"                 // Identifying the types of type-erased values.
+#include "binary_archive.hpp"        // Serializing objects of a looked up type.
+#include "detail/meta_exception.hpp" // Reporting invalid registrations.
+
+namespace reflect
+{
+    //====================
+    // Aliases
+    //====================
+    /**
+     * The function invoked for each property of a type-erased object, with the context supplied to
+     * meta_type::for_each, the name of the property, a pointer to its value, which is only valid during
+     * the call, and the key of its type, which can be compared against type_key().
+     */
+    using member_callback = void (*)(void* context, string_view name, const void* value, const void* type);
+
+    //====================
+    // Structs
+    //====================
+    /** The name, identifier and type-erased operations of a registered class, shared by every object of the class. */
+    struct meta_type
+    {
+        /** The name of the class, as returned by register_name(). */
+        std::string name;
+        /** The stable identifier of the class, which is a hash of its name. */
+        std::uint64_t id;
+
+        /** Default constructs an object of the class on the heap, or throws a meta_exception if the class is not default constructible. */
+        void* (*construct)();
+        /** Destroys an object created with construct. */
+        void (*destroy)(void* object);
+        /**
+         * Writes an object to a binary archive, preceded by the schema fingerprint of the class, or throws
+         * a meta_exception if a registered property cannot be archived.
+         */
+        void (*serialize)(const void* object, binary_writer& writer);
+        /**
+         * Reads an object from a binary archive, checking the schema fingerprint of the class, or throws
+         * a meta_exception if a registered property cannot be archived.
+         */
+        void (*deserialize)(void* object, binary_reader& reader);
+        /** Invokes the callback with each property of an object, in registration order. */
+        void (*for_each)(const void* object, void* context, member_callback callback);
+
+        /** The number of registered properties, which is one past the largest index. */
+        std::size_t member_count;
+        /** Copies the named member, which may be a dotted path, into a value of the type with the key. */
+        member_status (*get)(const void* object, string_view name, void* value, const void* type);
+        /** Copies the member at the position into a value of the type with the key. */
+        member_status (*get_at)(const void* object, std::size_t index, void* value, const void* type);
+        /** Sets the named member, which may be a dotted path, from a value of the type with the key. */
+        member_status (*set)(void* object, string_view name, const void* value, const void* type);
+        /** Sets the member at the position from a value of the type with the key. */
+        member_status (*set_at)(void* object, std::size_t index, const void* value, const void* type);
+        /** Invokes the callback with the named member, which may be a dotted path. */
+        member_status (*visit)(const void* object, string_view name, void* context, member_callback callback);
+        /** Invokes the callback with the member at the position. */
+        member_status (*visit_at)(const void* object, std::size_t index, void* context, member_callback callback);
+        /** Copies the named member, which may be a dotted path, into a value, which is empty if it was not found. */
+        value (*get_value)(const void* object, string_view name);
+    };
+
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /** @brief Default constructs an object of the class on the heap. */
+        template <typename Class, typename = std::enable_if_t<std::is_default_constructible<Class>::value>>
+        void* construct_object();
+
+        /** @brief Throws, as the class cannot be default constructed. */
+        template <typename Class, typename = std::enable_if_t<!std::is_default_constructible<Class>::value>, typename = void>
+        void* construct_object();
+
+        /** @brief Destroys an object created with construct_object(). */
+        template <typename Class>
+        void destroy_object(void* object);
+
+        /** @brief Writes an object to a binary archive. */
+        template <typename Class, typename = std::enable_if_t<is_archivable<Class>::value>>
+        void serialize_object(const void* object, binary_writer& writer);
+
+        /** @brief Throws, as the class has properties which cannot be archived. */
+        template <typename Class, typename = std::enable_if_t<!is_archivable<Class>::value>, typename = void>
+        void serialize_object(const void* object, binary_writer& writer);
+
+        /** @brief Reads an object from a binary archive. */
+        template <typename Class, typename = std::enable_if_t<is_archivable<Class>::value>>
+        void deserialize_object(void* object, binary_reader& reader);
+
+        /** @brief Throws, as the class has properties which cannot be archived. */
+        template <typename Class, typename = std::enable_if_t<!is_archivable<Class>::value>, typename = void>
+        void deserialize_object(void* object, binary_reader& reader);
+
+        /** @brief Invokes the callback with each property of an object. */
+        template <typename Class>
+        void for_each_member(const void* object, void* context, member_callback callback);
+
+        /** @brief Invokes the function with the named property or dotted path, without checking its type. */
+        template <typename Class, typename F>
+        member_status dispatch_erased(string_view name, F&& f);
+
+        /** @brief Invokes the function with the property at the position, without checking its type. */
+        template <typename Class, typename F>
+        member_status dispatch_erased_at(std::size_t index, F&& f);
+
+        /** @brief Copies the value of a property into a value of the type with the key, if the types match. */
+        template <typename Property, typename Class>
+        member_status get_erased(const Property& member, const Class& object, void* value, const void* type);
+
+        /** @brief Sets a property from a value of the type with the key, if the types match. */
+        template <typename Property, typename Class>
+        member_status set_erased(const Property& member, Class& object, const void* value, const void* type);
+
+        /** @brief Invokes the callback with the name, value and type key of a property. */
+        template <typename Property, typename Class>
+        member_status visit_erased(const Property& member, const Class& object, void* context, member_callback callback);
+
+        /** @brief Implements meta_type::get for a class. */
+        template <typename Class>
+        member_status get_member_erased(const void* object, string_view name, void* value, const void* type);
+
+        /** @brief Implements meta_type::get_at for a class. */
+        template <typename Class>
+        member_status get_member_at_erased(const void* object, std::size_t index, void* value, const void* type);
+
+        /** @brief Implements meta_type::set for a class. */
+        template <typename Class>
+        member_status set_member_erased(void* object, string_view name, const void* value, const void* type);
+
+        /** @brief Implements meta_type::set_at for a class. */
+        template <typename Class>
+        member_status set_member_at_erased(void* object, std::size_t index, const void* value, const void* type);
+
+        /** @brief Implements meta_type::visit for a class. */
+        template <typename Class>
+        member_status visit_member_erased(const void* object, string_view name, void* context, member_callback callback);
+
+        /** @brief Implements meta_type::visit_at for a class. */
+        template <typename Class>
+        member_status visit_member_at_erased(const void* object, std::size_t index, void* context, member_callback callback);
+
+        /** @brief Implements meta_type::get_value for a class. */
+        template <typename Class>
+        value get_value_erased(const void* object, string_view name);
+
+    } // namespace detail
+
+    class registry final
+    {
+    private:
+        //====================
+        // Private methods
+        //====================
+        /**
+         * @brief Retrieves the types that have been added, keyed by their identifiers.
+         *
+         * @returns The registered types.
+         */
+        static std::unordered_map<std::uint64_t, const meta_type*>& types();
+
+    public:
+        //====================
+        // Ctors and dtor
+        //====================
+        /**
+         * @brief Deleted constructor, as the registry is only accessed through its static methods.
+         */
+        registry() = delete;
+
+        //====================
+        // Methods
+        //====================
+        /**
+         * @brief Adds a registered class to the registry, so that it can be looked up by name or identifier.
+         *
+         * Classes are expected to be added during startup, typically by initializing a static variable
+         * with the result. The registry is not synchronized, so classes must not be added while other
+         * threads look types up; once every class has been added, lookups are safe from any thread.
+         *
+         * @throws meta_exception If the class has no registered name, or another class has the same identifier.
+         *
+         * @returns True, so that the result can initialize a static variable.
+         */
+        template <typename Class>
+        static bool add();
+
+        /**
+         * @brief Looks up a type by its registered name.
+         *
+         * @param name The name of the class.
+         *
+         * @returns The type, or a null pointer if no class has been added with the name.
+         */
+        static const meta_type* find(string_view name);
+
+        /**
+         * @brief Looks up a type by its stable identifier.
+         *
+         * @param id The identifier of the class, such as one read from a stream.
+         *
+         * @returns The type, or a null pointer if no class has been added with the identifier.
+         */
+        static const meta_type* find(std::uint64_t id);
+    };
+
+    //====================
+    // Functions
+    //====================
+    /**
+     * @brief Computes the stable identifier of a name, which is the same in every process.
+     *
+     * @param name The registered name of a class.
+     *
+     * @returns The identifier of the name.
+     */
+    constexpr std::uint64_t type_id(string_view name);
+
+    /**
+     * @brief Retrieves the stable identifier of a registered class, computed from its registered name.
+     *
+     * @returns The identifier of the class.
+     */
+    template <typename Class>
+    std::uint64_t type_id();
+
+    /**
+     * @brief Retrieves the type-erased operations of a registered class.
+     *
+     * The type is created once per class, and is the same object that is added to the registry.
+     *
+     * @returns The type of the class.
+     */
+    template <typename Class>
+    const meta_type& get_meta_type();
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "registry.inl" // Method declarations.
+
+#endif//_REFLECT_REGISTRY_HPP_
\ No newline at end of file
@@ -0,0 +1,343 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**********************************************************/
+        template <typename Class, typename>
+        void* construct_object()
+        {
+            return new Class();
+        }
+
+        /**********************************************************/
+        template <typename Class, typename, typename>
+        void* construct_object()
+        {
+            throw meta_exception("Cannot construct object: the class is not default constructible.");
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        void destroy_object(void* object)
+        {
+            delete static_cast<Class*>(object);
+        }
+
+        /**********************************************************/
+        template <typename Class, typename>
+        void serialize_object(const void* object, binary_writer& writer)
+        {
+            writer.write(*static_cast<const Class*>(object));
+        }
+
+        /**********************************************************/
+        template <typename Class, typename, typename>
+        void serialize_object(const void*, binary_writer&)
+        {
+            throw meta_exception("Cannot serialize object: the class has properties which cannot be archived.");
+        }
+
+        /**********************************************************/
+        template <typename Class, typename>
+        void deserialize_object(void* object, binary_reader& reader)
+        {
+            reader.read(*static_cast<Class*>(object));
+        }
+
+        /**********************************************************/
+        template <typename Class, typename, typename>
+        void deserialize_object(void*, binary_reader&)
+        {
+            throw meta_exception("Cannot deserialize object: the class has properties which cannot be archived.");
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        void for_each_member(const void* object, void* context, member_callback callback)
+        {
+            const Class& target = *static_cast<const Class*>(object);
+            for_tuple([&target, context, callback](const auto& member) {
+                visit_erased(member, target, context, callback);
+            }, get_members<Class>());
+        }
+
+        /**********************************************************/
+        template <typename Class, typename F>
+        member_status dispatch_erased(string_view name, F&& f)
+        {
+            const auto& index = metadata_t<Class, decltype(register_class<Class>())>::index();
+
+            const std::size_t position = index.find(name);
+            if (position != index.size())
+            {
+                return for_tuple_at<member_status>(position, f, get_members<Class>());
+            }
+
+            const auto& path_index = nested_paths<Class>::index();
+
+            const std::size_t path_position = path_index.find(name);
+            if (path_position != path_index.size())
+            {
+                return for_tuple_at<member_status>(path_position, f, nested_paths<Class>::paths());
+            }
+
+            return member_status::not_found;
+        }
+
+        /**********************************************************/
+        template <typename Class, typename F>
+        member_status dispatch_erased_at(std::size_t index, F&& f)
+        {
+            const auto& members = get_members<Class>();
+            if (index >= std::tuple_size<std::decay_t<decltype(members)>>::value)
+            {
+                return member_status::not_found;
+            }
+
+            return for_tuple_at<member_status>(index, f, members);
+        }
+
+        /**********************************************************/
+        template <typename Property, typename Class>
+        member_status get_erased(const Property& member, const Class& object, void* value, const void* type)
+        {
+            using member_type = get_member_type<Property>;
+            if (type != type_key<member_type>())
+            {
+                return member_status::type_mismatch;
+            }
+
+            *static_cast<member_type*>(value) = member.get_copy(object);
+            return member_status::found;
+        }
+
+        /**********************************************************/
+        template <typename Property, typename Class>
+        member_status set_erased(const Property& member, Class& object, const void* value, const void* type)
+        {
+            using member_type = get_member_type<Property>;
+            if (type != type_key<member_type>())
+            {
+                return member_status::type_mismatch;
+            }
+            else if (!member.has_setter() && !member.has_member())
+            {
+                return member_status::read_only;
+            }
+
+            member.set(object, *static_cast<const member_type*>(value));
+            return member_status::found;
+        }
+
+        /**********************************************************/
+        template <typename Property, typename Class>
+        member_status visit_erased(const Property& member, const Class& object, void* context, member_callback callback)
+        {
+            const string_view name = member.get_name();
+            member.visit(object, [context, callback, name](const auto& value) {
+                callback(context, name, &value, type_key<std::decay_t<decltype(value)>>());
+            });
+
+            return member_status::found;
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        member_status get_member_erased(const void* object, string_view name, void* value, const void* type)
+        {
+            const Class& target = *static_cast<const Class*>(object);
+            return dispatch_erased<Class>(name, [&target, value, type](const auto& member) {
+                return get_erased(member, target, value, type);
+            });
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        member_status get_member_at_erased(const void* object, std::size_t index, void* value, const void* type)
+        {
+            const Class& target = *static_cast<const Class*>(object);
+            return dispatch_erased_at<Class>(index, [&target, value, type](const auto& member) {
+                return get_erased(member, target, value, type);
+            });
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        member_status set_member_erased(void* object, string_view name, const void* value, const void* type)
+        {
+            Class& target = *static_cast<Class*>(object);
+            return dispatch_erased<Class>(name, [&target, value, type](const auto& member) {
+                return set_erased(member, target, value, type);
+            });
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        member_status set_member_at_erased(void* object, std::size_t index, const void* value, const void* type)
+        {
+            Class& target = *static_cast<Class*>(object);
+            return dispatch_erased_at<Class>(index, [&target, value, type](const auto& member) {
+                return set_erased(member, target, value, type);
+            });
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        member_status visit_member_erased(const void* object, string_view name, void* context, member_callback callback)
+        {
+            const Class& target = *static_cast<const Class*>(object);
+            return dispatch_erased<Class>(name, [&target, context, callback](const auto& member) {
+                return visit_erased(member, target, context, callback);
+            });
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        member_status visit_member_at_erased(const void* object, std::size_t index, void* context, member_callback callback)
+        {
+            const Class& target = *static_cast<const Class*>(object);
+            return dispatch_erased_at<Class>(index, [&target, context, callback](const auto& member) {
+                return visit_erased(member, target, context, callback);
+            });
+        }
+
+        /**********************************************************/
+        template <typename Class>
+        value get_value_erased(const void* object, string_view name)
+        {
+            const Class& target = *static_cast<const Class*>(object);
+
+            value result;
+            dispatch_erased<Class>(name, [&target, &result](const auto& member) {
+                member.visit(target, [&result](const auto& member_value) {
+                    result = value(member_value);
+                });
+
+                return member_status::found;
+            });
+
+            return result;
+        }
+
+    } // namespace detail
+
+    //====================
+    // Private methods
+    //====================
+    /**********************************************************/
+    inline std::unordered_map<std::uint64_t, const meta_type*>& registry::types()
+    {
+        static std::unordered_map<std::uint64_t, const meta_type*> types;
+        return types;
+    }
+
+    //====================
+    // Methods
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    bool registry::add()
+    {
+        const meta_type& type = get_meta_type<Class>();
+        if (type.name.empty())
+        {
+            throw detail::meta_exception("Cannot add class to the registry: no name has been registered.");
+        }
+
+        const auto result = types().emplace(type.id, &type);
+        if (!result.second && result.first->second != &type)
+        {
+            std::string err = std::string("Cannot add class to the registry: ") + type.name + std::string(" has the same identifier as ") + result.first->second->name + std::string(".");
+            throw detail::meta_exception(err);
+        }
+
+        return true;
+    }
+
+    /**********************************************************/
+    inline const meta_type* registry::find(string_view name)
+    {
+        // Identifiers are hashes, so the name is compared to rule out a collision with another name.
+        const meta_type* type = find(type_id(name));
+        return type != nullptr && string_view(type->name) == name ? type : nullptr;
+    }
+
+    /**********************************************************/
+    inline const meta_type* registry::find(std::uint64_t id)
+    {
+        const auto& registered = types();
+
+        const auto it = registered.find(id);
+        return it != registered.end() ? it->second : nullptr;
+    }
+
+    //====================
+    // Functions
+    //====================
+    /**********************************************************/
+    constexpr std::uint64_t type_id(string_view name)
+    {
+        return detail::hash_schema(14695981039346656037ull, name);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    std::uint64_t type_id()
+    {
+        static const std::uint64_t id = type_id(register_name<Class>());
+        return id;
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    const meta_type& get_meta_type()
+    {
+        static_assert(is_registered<Class>(), "Only registered classes have a meta type.");
+
+        static const meta_type type = {
+            register_name<Class>(),
+            type_id<Class>(),
+            &detail::construct_object<Class>,
+            &detail::destroy_object<Class>,
+            &detail::serialize_object<Class>,
+            &detail::deserialize_object<Class>,
+            &detail::for_each_member<Class>,
+            std::tuple_size<std::decay_t<decltype(register_class<Class>())>>::value,
+            &detail::get_member_erased<Class>,
+            &detail::get_member_at_erased<Class>,
+            &detail::set_member_erased<Class>,
+            &detail::set_member_at_erased<Class>,
+            &detail::visit_member_erased<Class>,
+            &detail::visit_member_at_erased<Class>,
+            &detail::get_value_erased<Class>
+        };
+
+        return type;
+    }
+
+} // namespace reflect
\ No newline at end of file
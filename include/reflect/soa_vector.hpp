@@ -0,0 +1,415 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_SOA_VECTOR_HPP_
+#define _REFLECT_SOA_VECTOR_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef>     // Sizes and positions of rows.
+#include <tuple>       // Storing a column for each property.
+#include <type_traits> // Checking the registered properties.
+#include <utility>     // Index sequences over the columns.
+#include <vector>      // Storing the values of each column.
+
+//====================
+// Reflect includes
+//====================
+#include "meta_class.hpp"            // Iterating and locating the registered properties.
+#include "span.hpp"                  // Viewing the columns.
+#include "string_view.hpp"           // Naming the columns.
+#include "detail/bitwise_layout.hpp" // Checking every registered property.
+#include "detail/meta_exception.hpp" // Reporting unknown or mismatched columns.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Structs
+        //====================
+        /** Builds the tuple of columns of a class, holding a vector for each registered property. */
+        template <typename Class, typename Indices>
+        struct soa_columns;
+
+        /** Builds the tuple of columns of a class, holding a vector for each registered property. */
+        template <typename Class, std::size_t... I>
+        struct soa_columns<Class, std::index_sequence<I...>>
+        {
+            /** Checks whether every property is bound to a member variable, which can be stored as a column. */
+            static constexpr bool storable = all_of<(is_member_accessor<typename property_at<Class, I>::accessor_type>::value &&
+                !std::is_same<member_type_at<Class, I>, bool>::value)...>::value;
+
+            using type = std::tuple<std::vector<member_type_at<Class, I>>...>;
+        };
+
+    } // namespace detail
+
+    template <typename Class>
+    class soa_vector final
+    {
+    private:
+        //====================
+        // Aliases
+        //====================
+        using indices = std::make_index_sequence<std::tuple_size<std::decay_t<decltype(register_class<Class>())>>::value>;
+        using columns = detail::soa_columns<Class, indices>;
+
+        static_assert(is_registered<Class>(), "Only registered classes can be stored as columns.");
+        static_assert(columns::storable, "Every property must be bound to a member variable that is not a bool, as a std::vector<bool> column cannot be viewed as a span.");
+
+        //====================
+        // Member variables
+        //====================
+        /** The values of each registered property, stored in registration order. */
+        typename columns::type m_columns;
+        /** The number of rows stored within the columns. */
+        std::size_t m_size;
+
+        //====================
+        // Private methods
+        //====================
+        /**
+         * @brief Throws an exception stating that no column is registered with the name.
+         *
+         * @param name The name of the column.
+         */
+        [[noreturn]] static void throw_unknown_column(string_view name);
+
+        /**
+         * @brief Throws an exception stating that the column does not hold the requested type.
+         *
+         * @param name The name of the column.
+         */
+        [[noreturn]] static void throw_type_mismatch(string_view name);
+
+        /** @brief Views a column whose values are of the requested type. */
+        template <typename T, typename U>
+        static std::enable_if_t<std::is_same<T, U>::value, span<T>> view_column(std::vector<U>& column, string_view name);
+
+        /** @brief Throws for a column whose values are not of the requested type. */
+        template <typename T, typename U>
+        static std::enable_if_t<!std::is_same<T, U>::value, span<T>> view_column(std::vector<U>& column, string_view name);
+
+        /**
+         * @brief Finds the position of the named column.
+         *
+         * @param name The name of the column.
+         *
+         * @returns The position of the column, or the number of columns if the name is not registered.
+         */
+        static std::size_t find_column(string_view name);
+
+        /**
+         * @brief Views the column at a position, which must hold values of the requested type.
+         *
+         * @throws meta_exception If the column does not match the supplied datatype.
+         *
+         * @param position The position of the column.
+         * @param name     The name of the column, for reporting a mismatch.
+         *
+         * @returns A span of the column.
+         */
+        template <typename T>
+        span<T> view_column(std::size_t position, string_view name);
+
+        /** @brief Creates the value returned for a name which is not registered, as meta_class::get_member does. */
+        template <typename T>
+        static std::enable_if_t<std::is_default_constructible<T>::value, T> missing_value(string_view name);
+
+        /** @brief Throws for a name which is not registered, as there is no default value of the datatype to return. */
+        template <typename T>
+        static std::enable_if_t<!std::is_default_constructible<T>::value, T> missing_value(string_view name);
+
+        /** @brief Appends the value of each property of the object to its column. */
+        template <std::size_t... I>
+        void push_back(const Class& object, std::index_sequence<I...>);
+
+        /** @brief Removes any values past the size from each column, after an append has failed part way. */
+        template <std::size_t... I>
+        void truncate(std::index_sequence<I...>);
+
+        /** @brief Writes the value of each column at the row into the object. */
+        template <std::size_t... I>
+        void read_row(std::size_t index, Class& object, std::index_sequence<I...>) const;
+
+        /** @brief Writes the value of each property of the object into its column at the row. */
+        template <std::size_t... I>
+        void write_row(std::size_t index, const Class& object, std::index_sequence<I...>);
+
+        /** @brief Invokes the lambda with each property and its value at the row. */
+        template <typename F, std::size_t... I>
+        void for_each_value(std::size_t index, F& f, std::index_sequence<I...>);
+
+        /** @brief Invokes the lambda with each property and a constant reference to its value at the row. */
+        template <typename F, std::size_t... I>
+        void for_each_value(std::size_t index, F& f, std::index_sequence<I...>) const;
+
+    public:
+        //====================
+        // Structs
+        //====================
+        /**
+         * A reference to a single row, accessed with the same interface as a meta_class.
+         *
+         * Only the names of the registered properties are looked up, as nested members are not stored
+         * in columns of their own; a dotted path is treated as a name which is not registered.
+         */
+        class row final
+        {
+        private:
+            //====================
+            // Member variables
+            //====================
+            /** The container of the row. */
+            soa_vector* m_container;
+            /** The position of the row. */
+            std::size_t m_index;
+
+        public:
+            //====================
+            // Ctors and dtor
+            //====================
+            /**
+             * @brief Constructor for referencing a row of a container.
+             *
+             * @param container The container of the row.
+             * @param index     The position of the row.
+             */
+            row(soa_vector& container, std::size_t index);
+
+            /**
+             * @brief Default destructor.
+             */
+            ~row() = default;
+
+            //====================
+            // Methods
+            //====================
+            /**
+             * @brief Retrieves the value of a member variable of the row.
+             *
+             * If the name is not registered, a default constructed value is returned, or a meta_exception
+             * is thrown if the datatype is not default constructible.
+             *
+             * @throws meta_exception If the member variable does not match the supplied datatype.
+             *
+             * @param name The name of the member variable.
+             *
+             * @returns A copy of the value.
+             */
+            template <typename T>
+            T get_member(string_view name) const;
+
+            /**
+             * @brief Sets the value of a member variable of the row.
+             *
+             * If the name is not registered, no information is changed. The value is forwarded into
+             * the column, so an rvalue is moved rather than copied.
+             *
+             * @throws meta_exception If the member variable does not match the supplied datatype.
+             *
+             * @param name  The name of the member variable.
+             * @param value The value to set.
+             */
+            template <typename T, typename V, typename = std::enable_if_t<std::is_constructible<T, V>::value>>
+            void set_member(string_view name, V&& value);
+
+            /**
+             * @brief Iterator method that takes a lambda to iterate over the meta-data.
+             *
+             * The lambda is invoked with each registered property, in registration order, as with
+             * meta_class::for_each.
+             *
+             * @param f The lambda to iterate the meta-data with.
+             */
+            template <typename F>
+            void for_each(F&& f) const;
+
+            /**
+             * @brief Iterator method that takes a lambda to visit the value of every member variable of the row.
+             *
+             * The lambda is invoked with each registered property and a reference to its value within
+             * the row, in registration order.
+             *
+             * @param f The lambda to visit the member variables with.
+             */
+            template <typename F>
+            void for_each_value(F&& f);
+
+            /**
+             * @brief Iterator method that takes a lambda to visit the value of every member variable of the row.
+             *
+             * The lambda is invoked with each registered property and a constant reference to its value
+             * within the row, in registration order.
+             *
+             * @param f The lambda to visit the member variables with.
+             */
+            template <typename F>
+            void for_each_value(F&& f) const;
+        };
+
+        //====================
+        // Ctors and dtor
+        //====================
+        /**
+         * @brief Constructor for creating an empty container.
+         */
+        soa_vector();
+
+        /**
+         * @brief Default destructor.
+         */
+        ~soa_vector() = default;
+
+        //====================
+        // Getters and setters
+        //====================
+        /**
+         * @brief Retrieves the number of rows.
+         *
+         * @returns The number of stored objects.
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief Checks whether the container holds any rows.
+         *
+         * @returns True if the container is empty.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Retrieves the values of one property for every row.
+         *
+         * @tparam I The position of the property in registration order.
+         *
+         * @returns A span of the column, which is invalidated when rows are added or removed.
+         */
+        template <std::size_t I>
+        span<detail::member_type_at<Class, I>> column();
+
+        /**
+         * @brief Retrieves the values of one property for every row.
+         *
+         * @tparam I The position of the property in registration order.
+         *
+         * @returns A span of the column, which is invalidated when rows are added or removed.
+         */
+        template <std::size_t I>
+        span<const detail::member_type_at<Class, I>> column() const;
+
+        /**
+         * @brief Retrieves the values of the named property for every row.
+         *
+         * @throws meta_exception If the member variable is not registered, or does not match the supplied datatype.
+         *
+         * @param name The name of the member variable.
+         *
+         * @returns A span of the column, which is invalidated when rows are added or removed.
+         */
+        template <typename T>
+        span<T> column(string_view name);
+
+        /**
+         * @brief Retrieves the values of the named property for every row.
+         *
+         * @throws meta_exception If the member variable is not registered, or does not match the supplied datatype.
+         *
+         * @param name The name of the member variable.
+         *
+         * @returns A span of the column, which is invalidated when rows are added or removed.
+         */
+        template <typename T>
+        span<const T> column(string_view name) const;
+
+        //====================
+        // Methods
+        //====================
+        /**
+         * @brief Reserves space within every column.
+         *
+         * @param capacity The number of rows to reserve space for.
+         */
+        void reserve(std::size_t capacity);
+
+        /**
+         * @brief Resizes every column, default constructing any new values.
+         *
+         * @param size The number of rows.
+         */
+        void resize(std::size_t size);
+
+        /**
+         * @brief Removes every row.
+         */
+        void clear();
+
+        /**
+         * @brief Appends an object, copying each of its registered properties into its column.
+         *
+         * If copying any property throws, the values already appended to the other columns are removed,
+         * so the container is left unchanged.
+         *
+         * @param object The object to append.
+         */
+        void push_back(const Class& object);
+
+        /**
+         * @brief Reassembles the object stored within a row.
+         *
+         * @param index The position of the row, which must be less than the size.
+         *
+         * @returns A copy of the object.
+         */
+        Class get(std::size_t index) const;
+
+        /**
+         * @brief Replaces the values of a row with the registered properties of an object.
+         *
+         * @param index  The position of the row, which must be less than the size.
+         * @param object The object to copy from.
+         */
+        void set(std::size_t index, const Class& object);
+
+        //====================
+        // Operators
+        //====================
+        /**
+         * @brief Retrieves a reference to a row.
+         *
+         * @param index The position of the row, which must be less than the size.
+         *
+         * @returns A reference to the row.
+         */
+        row operator[](std::size_t index);
+    };
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "soa_vector.inl" // Method declarations.
+
+#endif//_REFLECT_SOA_VECTOR_HPP_
\ No newline at end of file
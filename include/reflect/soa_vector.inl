@@ -0,0 +1,361 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+namespace reflect
+{
+    //====================
+    // Ctors and dtor
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    soa_vector<Class>::row::row(soa_vector& container, std::size_t index)
+        : m_container(&container), m_index(index)
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    soa_vector<Class>::soa_vector()
+        : m_columns(), m_size(0)
+    {
+        // Empty.
+    }
+
+    //====================
+    // Private methods
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    void soa_vector<Class>::throw_unknown_column(string_view name)
+    {
+        std::string err = std::string("Member variable: ") + name.to_string() + std::string(" is not registered.");
+        throw detail::meta_exception(err);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    void soa_vector<Class>::throw_type_mismatch(string_view name)
+    {
+        std::string err = std::string("Member variable: ") + name.to_string() + std::string(" does not match the supplied datatype.");
+        throw detail::meta_exception(err);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T, typename U>
+    std::enable_if_t<std::is_same<T, U>::value, span<T>> soa_vector<Class>::view_column(std::vector<U>& column, string_view)
+    {
+        return span<T>(column.data(), column.size());
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T, typename U>
+    std::enable_if_t<!std::is_same<T, U>::value, span<T>> soa_vector<Class>::view_column(std::vector<U>&, string_view name)
+    {
+        throw_type_mismatch(name);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    std::size_t soa_vector<Class>::find_column(string_view name)
+    {
+        return detail::metadata_t<Class, decltype(register_class<Class>())>::index().find(name);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T>
+    span<T> soa_vector<Class>::view_column(std::size_t position, string_view name)
+    {
+        return detail::for_tuple_at<span<T>>(position, [name](auto& column) {
+            return view_column<T>(column, name);
+        }, m_columns);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T>
+    std::enable_if_t<std::is_default_constructible<T>::value, T> soa_vector<Class>::missing_value(string_view)
+    {
+        return T();
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T>
+    std::enable_if_t<!std::is_default_constructible<T>::value, T> soa_vector<Class>::missing_value(string_view name)
+    {
+        throw detail::meta_exception(std::string("Member variable: ") + name.to_string() + std::string(" was not found."));
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <std::size_t... I>
+    void soa_vector<Class>::push_back(const Class& object, std::index_sequence<I...>)
+    {
+        const auto& members = get_members<Class>();
+
+        using expand = bool[];
+        (void)expand { true, (std::get<I>(m_columns).push_back(std::get<I>(members).get_copy(object)), true)... };
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <std::size_t... I>
+    void soa_vector<Class>::truncate(std::index_sequence<I...>)
+    {
+        using expand = bool[];
+        (void)expand { true, (std::get<I>(m_columns).erase(std::get<I>(m_columns).begin() + m_size, std::get<I>(m_columns).end()), true)... };
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <std::size_t... I>
+    void soa_vector<Class>::read_row(std::size_t index, Class& object, std::index_sequence<I...>) const
+    {
+        const auto& members = get_members<Class>();
+
+        using expand = bool[];
+        (void)expand { true, (std::get<I>(members).set(object, std::get<I>(m_columns)[index]), true)... };
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <std::size_t... I>
+    void soa_vector<Class>::write_row(std::size_t index, const Class& object, std::index_sequence<I...>)
+    {
+        const auto& members = get_members<Class>();
+
+        using expand = bool[];
+        (void)expand { true, (std::get<I>(m_columns)[index] = std::get<I>(members).get_copy(object), true)... };
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename F, std::size_t... I>
+    void soa_vector<Class>::for_each_value(std::size_t index, F& f, std::index_sequence<I...>)
+    {
+        const auto& members = get_members<Class>();
+
+        using expand = bool[];
+        (void)expand { true, (f(std::get<I>(members), std::get<I>(m_columns)[index]), true)... };
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename F, std::size_t... I>
+    void soa_vector<Class>::for_each_value(std::size_t index, F& f, std::index_sequence<I...>) const
+    {
+        const auto& members = get_members<Class>();
+
+        using expand = bool[];
+        (void)expand { true, (f(std::get<I>(members), std::get<I>(m_columns)[index]), true)... };
+    }
+
+    //====================
+    // Getters and setters
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    std::size_t soa_vector<Class>::size() const
+    {
+        return m_size;
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    bool soa_vector<Class>::empty() const
+    {
+        return m_size == 0;
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <std::size_t I>
+    span<detail::member_type_at<Class, I>> soa_vector<Class>::column()
+    {
+        auto& column = std::get<I>(m_columns);
+        return span<detail::member_type_at<Class, I>>(column.data(), column.size());
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <std::size_t I>
+    span<const detail::member_type_at<Class, I>> soa_vector<Class>::column() const
+    {
+        const auto& column = std::get<I>(m_columns);
+        return span<const detail::member_type_at<Class, I>>(column.data(), column.size());
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T>
+    span<T> soa_vector<Class>::column(string_view name)
+    {
+        const std::size_t position = find_column(name);
+        if (position == std::tuple_size<typename columns::type>::value)
+        {
+            throw_unknown_column(name);
+        }
+
+        return this->view_column<T>(position, name);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T>
+    span<const T> soa_vector<Class>::column(string_view name) const
+    {
+        return const_cast<soa_vector*>(this)->column<T>(name);
+    }
+
+    //====================
+    // Methods
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    template <typename T>
+    T soa_vector<Class>::row::get_member(string_view name) const
+    {
+        const std::size_t position = find_column(name);
+        if (position == std::tuple_size<typename columns::type>::value)
+        {
+            return missing_value<T>(name);
+        }
+
+        return m_container->template view_column<T>(position, name)[m_index];
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename T, typename V, typename>
+    void soa_vector<Class>::row::set_member(string_view name, V&& value)
+    {
+        const std::size_t position = find_column(name);
+        if (position != std::tuple_size<typename columns::type>::value)
+        {
+            m_container->template view_column<T>(position, name)[m_index] = std::forward<V>(value);
+        }
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename F>
+    void soa_vector<Class>::row::for_each(F&& f) const
+    {
+        detail::for_tuple(std::forward<F>(f), get_members<Class>());
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename F>
+    void soa_vector<Class>::row::for_each_value(F&& f)
+    {
+        m_container->for_each_value(m_index, f, indices());
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    template <typename F>
+    void soa_vector<Class>::row::for_each_value(F&& f) const
+    {
+        static_cast<const soa_vector*>(m_container)->for_each_value(m_index, f, indices());
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    void soa_vector<Class>::reserve(std::size_t capacity)
+    {
+        detail::for_tuple([capacity](auto& column) {
+            column.reserve(capacity);
+        }, m_columns);
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    void soa_vector<Class>::resize(std::size_t size)
+    {
+        detail::for_tuple([size](auto& column) {
+            column.resize(size);
+        }, m_columns);
+
+        m_size = size;
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    void soa_vector<Class>::clear()
+    {
+        detail::for_tuple([](auto& column) {
+            column.clear();
+        }, m_columns);
+
+        m_size = 0;
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    void soa_vector<Class>::push_back(const Class& object)
+    {
+        try
+        {
+            push_back(object, indices());
+        }
+        catch (...)
+        {
+            truncate(indices());
+            throw;
+        }
+
+        ++m_size;
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    Class soa_vector<Class>::get(std::size_t index) const
+    {
+        Class object = Class();
+        read_row(index, object, indices());
+
+        return object;
+    }
+
+    /**********************************************************/
+    template <typename Class>
+    void soa_vector<Class>::set(std::size_t index, const Class& object)
+    {
+        write_row(index, object, indices());
+    }
+
+    //====================
+    // Operators
+    //====================
+    /**********************************************************/
+    template <typename Class>
+    typename soa_vector<Class>::row soa_vector<Class>::operator[](std::size_t index)
+    {
+        return row(*this, index);
+    }
+
+} // namespace reflect
\ No newline at end of file
@@ -0,0 +1,203 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_SPAN_HPP_
+#define _REFLECT_SPAN_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef>     // Sizes of the viewed elements.
+#include <type_traits> // Converting between spans of different constness.
+#include <vector>      // Viewing the contents of vectors.
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Structs
+        //====================
+        /**
+         * Checks whether elements of one type can be viewed as another, which only differs in constness.
+         *
+         * Conversions between pointers to base and derived classes are rejected, as the elements would
+         * then be indexed with the size of the wrong type.
+         */
+        template <typename From, typename To>
+        struct is_span_convertible : std::integral_constant<bool, std::is_same<std::remove_cv_t<From>, std::remove_cv_t<To>>::value &&
+                                                                  std::is_convertible<From (*)[], To (*)[]>::value>
+        {
+        };
+
+    } // namespace detail
+
+    template <typename T>
+    class span final
+    {
+    private:
+        //====================
+        // Member variables
+        //====================
+        /** The first element of the viewed sequence. */
+        T* m_data;
+        /** The number of elements within the viewed sequence. */
+        std::size_t m_size;
+
+    public:
+        //====================
+        // Ctors and dtor
+        //====================
+        /**
+         * @brief Constructor for creating an empty span.
+         */
+        constexpr span();
+
+        /**
+         * @brief Constructor for viewing a contiguous sequence of elements.
+         *
+         * @param data The first element to view.
+         * @param size The number of elements to view.
+         */
+        constexpr span(T* data, std::size_t size);
+
+        /**
+         * @brief Constructor for viewing the elements of an array.
+         *
+         * @param array The array to view.
+         */
+        template <std::size_t N>
+        constexpr span(T (&array)[N]);
+
+        /**
+         * @brief Constructor for viewing the elements of a vector.
+         *
+         * The span does not take ownership of the elements, so the vector must outlive it and must not be resized.
+         *
+         * @param values The vector to view.
+         */
+        template <typename U, typename = std::enable_if_t<detail::is_span_convertible<U, T>::value>>
+        span(std::vector<U>& values);
+
+        /**
+         * @brief Constructor for viewing the elements of a constant vector, which is only available to spans of constant elements.
+         *
+         * @param values The vector to view.
+         */
+        template <typename U, typename = std::enable_if_t<detail::is_span_convertible<const U, T>::value>, typename = void>
+        span(const std::vector<U>& values);
+
+        /**
+         * @brief Constructor for viewing the elements of another span, such as a span of mutable elements as constant.
+         *
+         * @param other The span to view.
+         */
+        template <typename U, typename = std::enable_if_t<detail::is_span_convertible<U, T>::value>>
+        constexpr span(const span<U>& other);
+
+        /**
+         * @brief Default destructor.
+         */
+        ~span() = default;
+
+        //====================
+        // Getters and setters
+        //====================
+        /**
+         * @brief Retrieves the first element of the viewed sequence.
+         *
+         * @returns A pointer to the viewed elements.
+         */
+        constexpr T* data() const;
+
+        /**
+         * @brief Retrieves the number of viewed elements.
+         *
+         * @returns The length of the span.
+         */
+        constexpr std::size_t size() const;
+
+        /**
+         * @brief Checks whether the span contains any elements.
+         *
+         * @returns True if the span is empty.
+         */
+        constexpr bool empty() const;
+
+        /**
+         * @brief Retrieves an iterator to the first viewed element.
+         *
+         * @returns A pointer to the first element.
+         */
+        constexpr T* begin() const;
+
+        /**
+         * @brief Retrieves an iterator past the last viewed element.
+         *
+         * @returns A pointer past the last element.
+         */
+        constexpr T* end() const;
+
+        //====================
+        // Operators
+        //====================
+        /**
+         * @brief Retrieves the element at the specified position.
+         *
+         * @param index The position of the element, which must be less than the size.
+         *
+         * @returns A reference to the element.
+         */
+        constexpr T& operator[](std::size_t index) const;
+    };
+
+    //====================
+    // Functions
+    //====================
+    /**
+     * @brief Creates a span viewing the elements of a vector, deducing the type of the elements.
+     *
+     * @param values The vector to view.
+     *
+     * @returns A span of the elements.
+     */
+    template <typename T>
+    span<T> make_span(std::vector<T>& values);
+
+    /**
+     * @brief Creates a span viewing the elements of a constant vector, deducing the type of the elements.
+     *
+     * @param values The vector to view.
+     *
+     * @returns A span of the constant elements.
+     */
+    template <typename T>
+    span<const T> make_span(const std::vector<T>& values);
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "span.inl" // Method declarations.
+
+#endif//_REFLECT_SPAN_HPP_
\ No newline at end of file
@@ -0,0 +1,145 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+namespace reflect
+{
+    //====================
+    // Ctors and dtor
+    //====================
+    /**********************************************************/
+    template <typename T>
+    constexpr span<T>::span()
+        : m_data(nullptr), m_size(0)
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    template <typename T>
+    constexpr span<T>::span(T* data, std::size_t size)
+        : m_data(data), m_size(size)
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    template <typename T>
+    template <std::size_t N>
+    constexpr span<T>::span(T (&array)[N])
+        : m_data(array), m_size(N)
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    template <typename T>
+    template <typename U, typename>
+    span<T>::span(std::vector<U>& values)
+        : m_data(values.data()), m_size(values.size())
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    template <typename T>
+    template <typename U, typename, typename>
+    span<T>::span(const std::vector<U>& values)
+        : m_data(values.data()), m_size(values.size())
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    template <typename T>
+    template <typename U, typename>
+    constexpr span<T>::span(const span<U>& other)
+        : m_data(other.data()), m_size(other.size())
+    {
+        // Empty.
+    }
+
+    //====================
+    // Getters and setters
+    //====================
+    /**********************************************************/
+    template <typename T>
+    constexpr T* span<T>::data() const
+    {
+        return m_data;
+    }
+
+    /**********************************************************/
+    template <typename T>
+    constexpr std::size_t span<T>::size() const
+    {
+        return m_size;
+    }
+
+    /**********************************************************/
+    template <typename T>
+    constexpr bool span<T>::empty() const
+    {
+        return m_size == 0;
+    }
+
+    /**********************************************************/
+    template <typename T>
+    constexpr T* span<T>::begin() const
+    {
+        return m_data;
+    }
+
+    /**********************************************************/
+    template <typename T>
+    constexpr T* span<T>::end() const
+    {
+        return m_data + m_size;
+    }
+
+    //====================
+    // Operators
+    //====================
+    /**********************************************************/
+    template <typename T>
+    constexpr T& span<T>::operator[](std::size_t index) const
+    {
+        return m_data[index];
+    }
+
+    //====================
+    // Functions
+    //====================
+    /**********************************************************/
+    template <typename T>
+    span<T> make_span(std::vector<T>& values)
+    {
+        return span<T>(values.data(), values.size());
+    }
+
+    /**********************************************************/
+    template <typename T>
+    span<const T> make_span(const std::vector<T>& values)
+    {
+        return span<const T>(values.data(), values.size());
+    }
+
+} // namespace reflect
\ No newline at end of file
@@ -0,0 +1,190 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_STRING_VIEW_HPP_
+#define _REFLECT_STRING_VIEW_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef> // Sizes of the viewed characters.
+#include <ostream> // Writing views to streams.
+#include <string>  // Converting to and from strings.
+
+namespace reflect
+{
+    class string_view final
+    {
+    private:
+        //====================
+        // Member variables
+        //====================
+        /** The first character of the viewed sequence. */
+        const char* m_data;
+        /** The number of characters within the viewed sequence. */
+        std::size_t m_size;
+
+    public:
+        //====================
+        // Ctors and dtor
+        //====================
+        /**
+         * @brief Constructor for creating an empty view.
+         */
+        constexpr string_view();
+
+        /**
+         * @brief Constructor for viewing a null-terminated string, such as a string literal.
+         *
+         * @param str The null-terminated characters to view.
+         */
+        constexpr string_view(const char* str);
+
+        /**
+         * @brief Constructor for viewing a sequence of characters.
+         *
+         * @param str  The first character to view.
+         * @param size The number of characters to view.
+         */
+        constexpr string_view(const char* str, std::size_t size);
+
+        /**
+         * @brief Constructor for viewing the contents of a string.
+         *
+         * The view does not take ownership of the characters, so the string must outlive it.
+         *
+         * @param str The string to view.
+         */
+        string_view(const std::string& str);
+
+        /**
+         * @brief Default destructor.
+         */
+        ~string_view() = default;
+
+        //====================
+        // Getters and setters
+        //====================
+        /**
+         * @brief Retrieves the first character of the viewed sequence.
+         *
+         * The sequence is not guaranteed to be null-terminated.
+         *
+         * @returns A pointer to the viewed characters.
+         */
+        constexpr const char* data() const;
+
+        /**
+         * @brief Retrieves the number of viewed characters.
+         *
+         * @returns The length of the view.
+         */
+        constexpr std::size_t size() const;
+
+        /**
+         * @brief Checks whether the view contains any characters.
+         *
+         * @returns True if the view is empty.
+         */
+        constexpr bool empty() const;
+
+        /**
+         * @brief Retrieves an iterator to the first viewed character.
+         *
+         * @returns A pointer to the first character.
+         */
+        constexpr const char* begin() const;
+
+        /**
+         * @brief Retrieves an iterator past the last viewed character.
+         *
+         * @returns A pointer past the last character.
+         */
+        constexpr const char* end() const;
+
+        //====================
+        // Methods
+        //====================
+        /**
+         * @brief Lexicographically compares the view with another view.
+         *
+         * @param other The view to compare against.
+         *
+         * @returns A negative value, zero or a positive value if the view is less than, equal to or greater than the other.
+         */
+        constexpr int compare(string_view other) const;
+
+        /**
+         * @brief Creates a string containing a copy of the viewed characters.
+         *
+         * @returns A copy of the viewed characters.
+         */
+        std::string to_string() const;
+
+        //====================
+        // Operators
+        //====================
+        /**
+         * @brief Retrieves the character at the specified position.
+         *
+         * @param index The position of the character.
+         *
+         * @returns The character at the position.
+         */
+        constexpr char operator[](std::size_t index) const;
+
+        /**
+         * @brief Creates a string containing a copy of the viewed characters.
+         *
+         * @returns A copy of the viewed characters.
+         */
+        operator std::string() const;
+    };
+
+    //====================
+    // Operators
+    //====================
+    /** @returns True if both views contain the same characters. */
+    constexpr bool operator==(string_view lhs, string_view rhs);
+    /** @returns True if the views contain different characters. */
+    constexpr bool operator!=(string_view lhs, string_view rhs);
+    /** @returns True if the left view orders before the right view. */
+    constexpr bool operator<(string_view lhs, string_view rhs);
+
+    /**
+     * @brief Writes the viewed characters to the output stream.
+     *
+     * @param stream The stream to write to.
+     * @param view   The view to write.
+     *
+     * @returns The stream that was written to.
+     */
+    std::ostream& operator<<(std::ostream& stream, string_view view);
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "string_view.inl" // Method declarations.
+
+#endif//_REFLECT_STRING_VIEW_HPP_
\ No newline at end of file
@@ -0,0 +1,171 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+namespace reflect
+{
+    namespace detail
+    {
+        //====================
+        // Functions
+        //====================
+        /**********************************************************/
+        constexpr std::size_t string_length(const char* str)
+        {
+            std::size_t size = 0;
+            while (str[size] != '\0')
+            {
+                ++size;
+            }
+
+            return size;
+        }
+
+    } // namespace detail
+
+    //====================
+    // Ctors and dtor
+    //====================
+    /**********************************************************/
+    constexpr string_view::string_view()
+        : m_data(""), m_size(0)
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    constexpr string_view::string_view(const char* str)
+        : m_data(str), m_size(detail::string_length(str))
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    constexpr string_view::string_view(const char* str, std::size_t size)
+        : m_data(str), m_size(size)
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    inline string_view::string_view(const std::string& str)
+        : m_data(str.data()), m_size(str.size())
+    {
+        // Empty.
+    }
+
+    //====================
+    // Getters and setters
+    //====================
+    /**********************************************************/
+    constexpr const char* string_view::data() const
+    {
+        return m_data;
+    }
+
+    /**********************************************************/
+    constexpr std::size_t string_view::size() const
+    {
+        return m_size;
+    }
+
+    /**********************************************************/
+    constexpr bool string_view::empty() const
+    {
+        return m_size == 0;
+    }
+
+    /**********************************************************/
+    constexpr const char* string_view::begin() const
+    {
+        return m_data;
+    }
+
+    /**********************************************************/
+    constexpr const char* string_view::end() const
+    {
+        return m_data + m_size;
+    }
+
+    //====================
+    // Methods
+    //====================
+    /**********************************************************/
+    constexpr int string_view::compare(string_view other) const
+    {
+        const std::size_t size = m_size < other.m_size ? m_size : other.m_size;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (m_data[i] != other.m_data[i])
+            {
+                return static_cast<unsigned char>(m_data[i]) < static_cast<unsigned char>(other.m_data[i]) ? -1 : 1;
+            }
+        }
+
+        return m_size == other.m_size ? 0 : (m_size < other.m_size ? -1 : 1);
+    }
+
+    /**********************************************************/
+    inline std::string string_view::to_string() const
+    {
+        return std::string(m_data, m_size);
+    }
+
+    //====================
+    // Operators
+    //====================
+    /**********************************************************/
+    constexpr char string_view::operator[](std::size_t index) const
+    {
+        return m_data[index];
+    }
+
+    /**********************************************************/
+    inline string_view::operator std::string() const
+    {
+        return this->to_string();
+    }
+
+    /**********************************************************/
+    constexpr bool operator==(string_view lhs, string_view rhs)
+    {
+        return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+    }
+
+    /**********************************************************/
+    constexpr bool operator!=(string_view lhs, string_view rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    /**********************************************************/
+    constexpr bool operator<(string_view lhs, string_view rhs)
+    {
+        return lhs.compare(rhs) < 0;
+    }
+
+    /**********************************************************/
+    inline std::ostream& operator<<(std::ostream& stream, string_view view)
+    {
+        return stream.write(view.data(), static_cast<std::streamsize>(view.size()));
+    }
+
+} // namespace reflect
\ No newline at end of file
@@ -0,0 +1,297 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _REFLECT_VALUE_HPP_
+#define _REFLECT_VALUE_HPP_
+
+//====================
+// C++ includes
+//====================
+#include <cstddef>     // Sizes and alignment of the inline storage.
+#include <string>      // Storing strings inline.
+#include <type_traits> // Choosing between inline and heap storage.
+#include <utility>     // Forwarding the stored values.
+
+namespace reflect
+{
+    //====================
+    // Functions
+    //====================
+    /**
+     * @brief Retrieves the key of a type, which identifies the type of values passed to a member_callback.
+     *
+     * The key is the address of a variable unique to the type, so no run-time type information is needed.
+     *
+     * @returns The key of the type.
+     */
+    template <typename T>
+    const void* type_key();
+
+    namespace detail
+    {
+        //====================
+        // Variables
+        //====================
+        /** The number of bytes a value can hold without allocating, which fits any arithmetic type or a string. */
+        constexpr std::size_t value_inline_size = sizeof(std::string);
+
+        //====================
+        // Structs
+        //====================
+        /** The operations on the type held by a value, which are shared by every value of the type. */
+        struct value_ops
+        {
+            /** Retrieves the key of the held type. */
+            const void* (*type)();
+            /** Copy constructs the held value of the source storage into the storage. */
+            void (*copy)(void* storage, const void* source);
+            /** Move constructs the held value of the source storage into the storage, leaving the source to be destroyed. */
+            void (*move)(void* storage, void* source);
+            /** Destroys the held value of the storage. */
+            void (*destroy)(void* storage);
+            /** Retrieves a pointer to the held value of the storage. */
+            const void* (*get)(const void* storage);
+        };
+
+        /**
+         * @brief Checks whether a type is held within the storage of a value, rather than on the heap.
+         *
+         * Types are held inline if they fit, and can be moved without throwing so that values can be too.
+         */
+        template <typename T>
+        struct stored_inline : std::integral_constant<bool, sizeof(T) <= value_inline_size &&
+                                                            alignof(T) <= alignof(std::max_align_t) &&
+                                                            std::is_nothrow_move_constructible<T>::value>
+        {
+        };
+
+        /** The operations on a type which is held within the storage of a value. */
+        template <typename T>
+        struct inline_value
+        {
+            /** Constructs the held value within the storage. */
+            template <typename U>
+            static void create(void* storage, U&& value);
+
+            static void copy(void* storage, const void* source);
+            static void move(void* storage, void* source) noexcept;
+            static void destroy(void* storage) noexcept;
+            static const void* get(const void* storage);
+
+            /** The operations referenced by each value holding the type. */
+            static constexpr value_ops ops = { &type_key<T>, &copy, &move, &destroy, &get };
+        };
+
+        /** The operations on a type which is held on the heap, with a pointer to it within the storage of a value. */
+        template <typename T>
+        struct heap_value
+        {
+            /** Constructs the held value on the heap. */
+            template <typename U>
+            static void create(void* storage, U&& value);
+
+            static void copy(void* storage, const void* source);
+            static void move(void* storage, void* source) noexcept;
+            static void destroy(void* storage) noexcept;
+            static const void* get(const void* storage);
+
+            /** The operations referenced by each value holding the type. */
+            static constexpr value_ops ops = { &type_key<T>, &copy, &move, &destroy, &get };
+        };
+
+        //====================
+        // Aliases
+        //====================
+        /** The operations used to hold a type within a value. */
+        template <typename T>
+        using value_storage = std::conditional_t<stored_inline<T>::value, inline_value<T>, heap_value<T>>;
+
+    } // namespace detail
+
+    /**
+     * @brief Holds a copy of a value of any copyable type, for reading and writing members whose type is only known at runtime.
+     *
+     * Arithmetic types, enums, strings and other types which fit within the storage of the value are held
+     * inline, and only larger types are allocated on the heap. Short strings are therefore held without
+     * allocating, by the short string optimisation of the string itself. The held type is identified by
+     * its type_key(), so no run-time type information is needed.
+     */
+    class value final
+    {
+    private:
+        //====================
+        // Member variables
+        //====================
+        /** The held value, or a pointer to it if it is held on the heap. */
+        alignas(std::max_align_t) unsigned char m_storage[detail::value_inline_size];
+        /** The operations on the held type, or a null pointer if the value is empty. */
+        const detail::value_ops* m_ops;
+
+        //====================
+        // Private methods
+        //====================
+        /**
+         * @brief Throws the exception for retrieving a type which is not held.
+         *
+         * @throws meta_exception As the value does not hold the requested type.
+         */
+        [[noreturn]] static void throw_type_mismatch();
+
+        /**
+         * @brief Destroys the held value, leaving the value empty.
+         */
+        void reset() noexcept;
+
+    public:
+        //====================
+        // Ctors and dtor
+        //====================
+        /**
+         * @brief Constructor for an empty value.
+         */
+        value();
+
+        /**
+         * @brief Constructor for holding a copy of a value.
+         *
+         * @param other The value to hold, which is moved if it is an rvalue.
+         */
+        template <typename T, typename = std::enable_if_t<!std::is_same<std::decay_t<T>, value>::value>>
+        value(T&& other);
+
+        /**
+         * @brief Constructor for holding a string, so that string literals are held as strings rather than pointers.
+         *
+         * @param str The null-terminated characters to copy.
+         */
+        value(const char* str);
+
+        /**
+         * @brief Copy constructor, which copies the held value.
+         *
+         * @param other The value to copy.
+         */
+        value(const value& other);
+
+        /**
+         * @brief Move constructor, which moves the held value without allocating.
+         *
+         * @param other The value to move, which is left empty.
+         */
+        value(value&& other) noexcept;
+
+        /**
+         * @brief Destructor, which destroys the held value.
+         */
+        ~value();
+
+        //====================
+        // Getters and setters
+        //====================
+        /**
+         * @brief Checks whether the value holds anything.
+         *
+         * @returns True if the value is empty.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Checks whether the held value is stored inline, rather than on the heap.
+         *
+         * @returns True if the value is empty or held without allocating.
+         */
+        bool is_inline() const;
+
+        /**
+         * @brief Checks whether the value holds the supplied type.
+         *
+         * @returns True if the held value is of the type.
+         */
+        template <typename T>
+        bool is() const;
+
+        /**
+         * @brief Retrieves the key of the held type, which can be compared against type_key().
+         *
+         * @returns The key of the held type, or a null pointer if the value is empty.
+         */
+        const void* type() const;
+
+        /**
+         * @brief Retrieves a pointer to the held value, whose type is given by type().
+         *
+         * @returns The held value, or a null pointer if the value is empty.
+         */
+        const void* data() const;
+
+        /**
+         * @brief Retrieves the held value.
+         *
+         * @tparam T The type of the held value.
+         *
+         * @returns A reference to the held value, which is valid until the value is changed or destroyed.
+         *
+         * @throws meta_exception If the value does not hold the supplied type.
+         */
+        template <typename T>
+        const T& get() const;
+
+        /**
+         * @brief Retrieves the held value without throwing.
+         *
+         * @tparam T The type of the held value.
+         *
+         * @returns A pointer to the held value, or a null pointer if the value does not hold the supplied type.
+         */
+        template <typename T>
+        const T* get_if() const;
+
+        //====================
+        // Operators
+        //====================
+        /**
+         * @brief Copy assignment operator, which copies the held value.
+         *
+         * @param other The value to copy.
+         *
+         * @returns A reference to the value.
+         */
+        value& operator=(const value& other);
+
+        /**
+         * @brief Move assignment operator, which moves the held value without allocating.
+         *
+         * @param other The value to move, which is left empty.
+         *
+         * @returns A reference to the value.
+         */
+        value& operator=(value&& other) noexcept;
+    };
+
+} // namespace reflect
+
+//====================
+// Reflect includes
+//====================
+#include "value.inl" // Method declarations.
+
+#endif//_REFLECT_VALUE_HPP_
\ No newline at end of file
@@ -0,0 +1,298 @@
+/*
+* Reflect Library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+//====================
+// C++ includes
+//====================
+#include <new> // Constructing the held values within the storage.
+
+//====================
+// Reflect includes
+//====================
+#include "detail/meta_exception.hpp" // Reporting mismatched types.
+
+namespace reflect
+{
+    //====================
+    // Functions
+    //====================
+    /**********************************************************/
+    template <typename T>
+    const void* type_key()
+    {
+        // The variable is not constant, so that identical constants cannot be merged into a single address.
+        static char key;
+        return &key;
+    }
+
+    namespace detail
+    {
+        //====================
+        // Structs
+        //====================
+        /**********************************************************/
+        template <typename T>
+        constexpr value_ops inline_value<T>::ops;
+
+        /**********************************************************/
+        template <typename T>
+        template <typename U>
+        void inline_value<T>::create(void* storage, U&& value)
+        {
+            new (storage) T(std::forward<U>(value));
+        }
+
+        /**********************************************************/
+        template <typename T>
+        void inline_value<T>::copy(void* storage, const void* source)
+        {
+            new (storage) T(*static_cast<const T*>(source));
+        }
+
+        /**********************************************************/
+        template <typename T>
+        void inline_value<T>::move(void* storage, void* source) noexcept
+        {
+            new (storage) T(std::move(*static_cast<T*>(source)));
+        }
+
+        /**********************************************************/
+        template <typename T>
+        void inline_value<T>::destroy(void* storage) noexcept
+        {
+            static_cast<T*>(storage)->~T();
+        }
+
+        /**********************************************************/
+        template <typename T>
+        const void* inline_value<T>::get(const void* storage)
+        {
+            return storage;
+        }
+
+        /**********************************************************/
+        template <typename T>
+        constexpr value_ops heap_value<T>::ops;
+
+        /**********************************************************/
+        template <typename T>
+        template <typename U>
+        void heap_value<T>::create(void* storage, U&& value)
+        {
+            *static_cast<T**>(storage) = new T(std::forward<U>(value));
+        }
+
+        /**********************************************************/
+        template <typename T>
+        void heap_value<T>::copy(void* storage, const void* source)
+        {
+            *static_cast<T**>(storage) = new T(**static_cast<T* const*>(source));
+        }
+
+        /**********************************************************/
+        template <typename T>
+        void heap_value<T>::move(void* storage, void* source) noexcept
+        {
+            *static_cast<T**>(storage) = *static_cast<T**>(source);
+            *static_cast<T**>(source) = nullptr;
+        }
+
+        /**********************************************************/
+        template <typename T>
+        void heap_value<T>::destroy(void* storage) noexcept
+        {
+            delete *static_cast<T**>(storage);
+        }
+
+        /**********************************************************/
+        template <typename T>
+        const void* heap_value<T>::get(const void* storage)
+        {
+            return *static_cast<T* const*>(storage);
+        }
+
+    } // namespace detail
+
+    //====================
+    // Ctors and dtor
+    //====================
+    /**********************************************************/
+    inline value::value()
+        : m_ops(nullptr)
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    template <typename T, typename>
+    value::value(T&& other)
+        : m_ops(nullptr)
+    {
+        using held_type = std::decay_t<T>;
+        static_assert(std::is_copy_constructible<held_type>::value, "Only copyable types can be held by a value.");
+
+        detail::value_storage<held_type>::create(m_storage, std::forward<T>(other));
+        m_ops = &detail::value_storage<held_type>::ops;
+    }
+
+    /**********************************************************/
+    inline value::value(const char* str)
+        : value(std::string(str))
+    {
+        // Empty.
+    }
+
+    /**********************************************************/
+    inline value::value(const value& other)
+        : m_ops(nullptr)
+    {
+        if (other.m_ops != nullptr)
+        {
+            other.m_ops->copy(m_storage, other.m_storage);
+            m_ops = other.m_ops;
+        }
+    }
+
+    /**********************************************************/
+    inline value::value(value&& other) noexcept
+        : m_ops(nullptr)
+    {
+        if (other.m_ops != nullptr)
+        {
+            other.m_ops->move(m_storage, other.m_storage);
+            m_ops = other.m_ops;
+            other.reset();
+        }
+    }
+
+    /**********************************************************/
+    inline value::~value()
+    {
+        this->reset();
+    }
+
+    //====================
+    // Private methods
+    //====================
+    /**********************************************************/
+    inline void value::throw_type_mismatch()
+    {
+        throw detail::meta_exception("Value does not hold the requested type.");
+    }
+
+    /**********************************************************/
+    inline void value::reset() noexcept
+    {
+        if (m_ops != nullptr)
+        {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+    //====================
+    // Getters and setters
+    //====================
+    /**********************************************************/
+    inline bool value::empty() const
+    {
+        return m_ops == nullptr;
+    }
+
+    /**********************************************************/
+    inline bool value::is_inline() const
+    {
+        return m_ops == nullptr || m_ops->get(m_storage) == m_storage;
+    }
+
+    /**********************************************************/
+    template <typename T>
+    bool value::is() const
+    {
+        return m_ops == &detail::value_storage<T>::ops;
+    }
+
+    /**********************************************************/
+    inline const void* value::type() const
+    {
+        return m_ops != nullptr ? m_ops->type() : nullptr;
+    }
+
+    /**********************************************************/
+    inline const void* value::data() const
+    {
+        return m_ops != nullptr ? m_ops->get(m_storage) : nullptr;
+    }
+
+    /**********************************************************/
+    template <typename T>
+    const T& value::get() const
+    {
+        const T* held = this->get_if<T>();
+        if (held == nullptr)
+        {
+            throw_type_mismatch();
+        }
+
+        return *held;
+    }
+
+    /**********************************************************/
+    template <typename T>
+    const T* value::get_if() const
+    {
+        return this->is<T>() ? static_cast<const T*>(detail::value_storage<T>::get(m_storage)) : nullptr;
+    }
+
+    //====================
+    // Operators
+    //====================
+    /**********************************************************/
+    inline value& value::operator=(const value& other)
+    {
+        if (this != &other)
+        {
+            value copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    /**********************************************************/
+    inline value& value::operator=(value&& other) noexcept
+    {
+        if (this != &other)
+        {
+            this->reset();
+            if (other.m_ops != nullptr)
+            {
+                other.m_ops->move(m_storage, other.m_storage);
+                m_ops = other.m_ops;
+                other.reset();
+            }
+        }
+
+        return *this;
+    }
+
+} // namespace reflect
\ No newline at end of file
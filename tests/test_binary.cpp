@@ -0,0 +1,117 @@
+/*
+* Reflect library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <catch.hpp>                  // Unit-testing framework.
+#include "test_object.hpp"            // Test object.
+#include <reflect/binary_archive.hpp> // Binary serialization.
+
+/**********************************************************/
+TEST_CASE("Writing an object to a binary archive.", "[reflect]")
+{
+	// Arrange.
+	test_point point{ 0x01020304, 1.0f };
+
+	// Act.
+	std::vector<char> archive = reflect::to_binary(point);
+
+	// Assert.
+	REQUIRE(archive.size() == 16);
+	REQUIRE(std::vector<char>(archive.begin() + 8, archive.end()) == std::vector<char>{ 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, char(0x80), 0x3F });
+	REQUIRE(reflect::binary_reader(archive.data(), archive.size()).fingerprint() == reflect::schema_fingerprint<test_point>());
+}
+
+/**********************************************************/
+TEST_CASE("Reading nested objects from a binary archive.", "[reflect]")
+{
+	// Arrange.
+	test_segment segment{ { 1, 2.5f }, { -3, 0.5f }, std::string("a\0b", 3), true };
+	test_object object;
+	object.set_value(-42);
+	object.set_string("text");
+	object.set_colour(eColour::BLUE);
+	test_blob blob;
+	blob.set_data(std::vector<int>{ 1, 2, 3 });
+	test_segment read_segment{ { 0, 0.0f }, { 0, 0.0f }, "", false };
+	test_object read_object;
+	test_blob read_blob;
+
+	// Act.
+	reflect::from_binary(reflect::to_binary(segment), read_segment);
+	reflect::from_binary(reflect::to_binary(object), read_object);
+	reflect::from_binary(reflect::to_binary(blob), read_blob);
+
+	// Assert.
+	REQUIRE(read_segment.start.x == 1);
+	REQUIRE(read_segment.start.y == 2.5f);
+	REQUIRE(read_segment.end.x == -3);
+	REQUIRE(read_segment.end.y == 0.5f);
+	REQUIRE(read_segment.label == std::string("a\0b", 3));
+	REQUIRE(read_segment.visible);
+	REQUIRE(read_object.get_value() == -42);
+	REQUIRE(read_object.get_string() == "text");
+	REQUIRE(read_object.get_colour() == eColour::BLUE);
+	REQUIRE(read_blob.get_data() == std::vector<int>{ 1, 2, 3 });
+}
+
+/**********************************************************/
+TEST_CASE("Reading a binary archive with a different schema or truncated bytes throws.", "[reflect]")
+{
+	// Arrange.
+	std::vector<char> archive = reflect::to_binary(test_point{ 1, 2.0f });
+	std::vector<char> truncated(archive.begin(), archive.end() - 1);
+	test_point point{ 0, 0.0f };
+	test_segment segment{ { 0, 0.0f }, { 0, 0.0f }, "", false };
+
+	// Act & Assert.
+	REQUIRE(reflect::schema_fingerprint<test_point>() != reflect::schema_fingerprint<test_segment>());
+	REQUIRE_THROWS_AS(reflect::from_binary(archive, segment), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::from_binary(truncated, point), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Plain structs are archived as their member bytes.", "[reflect]")
+{
+	// Arrange.
+	test_path path{ { { 1, 2.0f }, { 3, 4.0f }, { 5, 6.0f } } };
+	test_tagged tagged{ 'a', 7, { 8, 9.0f } };
+	test_path read_path;
+	test_tagged read_tagged{ 'b', 0, { 0, 0.0f } };
+
+	// Act.
+	std::vector<char> path_archive = reflect::to_binary(path);
+	std::vector<char> tagged_archive = reflect::to_binary(tagged);
+	reflect::from_binary(path_archive, read_path);
+	reflect::from_binary(tagged_archive, read_tagged);
+
+	// Assert.
+	REQUIRE(path_archive.size() == 8 + 4 + 3 * 8);
+	REQUIRE(tagged_archive.size() == 8 + 1 + 4 + 8);
+	REQUIRE(tagged_archive[8] == 'a');
+	REQUIRE(tagged_archive[9] == 7);
+	REQUIRE(read_path.points.size() == 3);
+	REQUIRE(read_path.points[2].x == 5);
+	REQUIRE(read_path.points[2].y == 6.0f);
+	REQUIRE(read_tagged.tag == 'a');
+	REQUIRE(read_tagged.id == 7);
+	REQUIRE(read_tagged.point.x == 8);
+	REQUIRE(read_tagged.point.y == 9.0f);
+}
\ No newline at end of file
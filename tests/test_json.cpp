@@ -0,0 +1,218 @@
+/*
+* Reflect library
+* 2017 - Benjamin Carter (bencarterdev@outlook.com)
+*
+* This software is provided 'as-is', without any express or implied warranty.
+* In no event will the authors be held liable for any damages arising from the use of this software.
+*
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it freely,
+* subject to the following restrictions:
+*
+* 1. The origin of this software must not be misrepresented;
+*    you must not claim that you wrote the original software.
+*    If you use this software in a product, an acknowledgement
+*    in the product documentation would be appreciated but is not required.
+*
+* 2. Altered source versions must be plainly marked as such,
+*    and must not be misrepresented as being the original software.
+*
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <clocale>                 // Switching the decimal separator.
+#include <cstring>                 // Checking the decimal separator.
+#include <string>                  // Restoring the previous locale.
+#include <catch.hpp>               // Unit-testing framework.
+#include "test_object.hpp"         // Test object.
+#include <reflect/json_writer.hpp> // JSON serialization.
+#include <reflect/json_reader.hpp> // JSON deserialization.
+
+/**********************************************************/
+TEST_CASE("Writing an object as JSON.", "[reflect]")
+{
+	// Arrange.
+	test_object object;
+	object.set_value(-42);
+	object.set_string("say \"hi\"\n");
+	object.set_colour(eColour::GREEN);
+
+	// Act.
+	std::string json = reflect::to_json(object);
+
+	// Assert.
+	REQUIRE(json == "{\"value\":-42,\"string\":\"say \\\"hi\\\"\\n\",\"readonly\":0,\"colour\":\"Green\"}");
+}
+
+/**********************************************************/
+TEST_CASE("Writing nested objects and arrays as JSON.", "[reflect]")
+{
+	// Arrange.
+	test_segment segment{ { 1, 2.5f }, { -3, 0.5f }, "a\x01", true };
+	test_blob blob;
+	blob.set_data(std::vector<int>{ 1, 2, 3 });
+	reflect::json_writer writer;
+
+	// Act.
+	writer.write(segment);
+	std::string nested = writer.str();
+	writer.clear();
+	writer.write(blob);
+
+	// Assert.
+	REQUIRE(nested == "{\"start\":{\"x\":1,\"y\":2.5},\"end\":{\"x\":-3,\"y\":0.5},\"label\":\"a\\u0001\",\"visible\":true}");
+	REQUIRE(writer.str() == "{\"data\":[1,2,3]}");
+}
+
+/**********************************************************/
+TEST_CASE("Reading an object from JSON.", "[reflect]")
+{
+	// Arrange.
+	test_object object;
+	const std::string json = " { \"unknown\" : { \"a\" : [ 1, \"}\", null ] }, \"value\" : -42, \"readonly\" : 3.5,"
+		" \"string\" : \"say \\\"hi\\\"\\n\\u00e9\\ud83d\\ude00\", \"colour\" : \"Green\" } ";
+
+	// Act.
+	reflect::from_json(json, object);
+
+	// Assert.
+	REQUIRE(object.get_value() == -42);
+	REQUIRE(object.get_string() == "say \"hi\"\n\xc3\xa9\xf0\x9f\x98\x80");
+	REQUIRE(object.get_readonly() == 0.0f);
+	REQUIRE(object.get_colour() == eColour::GREEN);
+}
+
+/**********************************************************/
+TEST_CASE("Reading nested objects and arrays written as JSON.", "[reflect]")
+{
+	// Arrange.
+	test_segment segment{ { 1, 2.5f }, { -3, 0.5f }, "a\x01", true };
+	test_blob blob;
+	blob.set_data(std::vector<int>{ 1, 2, 3 });
+	test_segment read_segment{ { 0, 0.0f }, { 0, 0.0f }, "", false };
+	test_blob read_blob;
+
+	// Act.
+	reflect::from_json(reflect::to_json(segment), read_segment);
+	reflect::from_json(reflect::to_json(blob), read_blob);
+
+	// Assert.
+	REQUIRE(read_segment.start.x == 1);
+	REQUIRE(read_segment.start.y == 2.5f);
+	REQUIRE(read_segment.end.x == -3);
+	REQUIRE(read_segment.end.y == 0.5f);
+	REQUIRE(read_segment.label == "a\x01");
+	REQUIRE(read_segment.visible);
+	REQUIRE(read_blob.get_data() == std::vector<int>{ 1, 2, 3 });
+}
+
+/**********************************************************/
+TEST_CASE("Reading malformed JSON throws.", "[reflect]")
+{
+	// Arrange.
+	test_object object;
+
+	// Act & Assert.
+	REQUIRE_THROWS_AS(reflect::from_json("{\"value\":1", object), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::from_json("{\"value\":\"1\"}", object), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::from_json("{\"value\":99999999999}", object), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::from_json("{\"value\":1} {}", object), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::from_json("{\"colour\":\"Purple\"}", object), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::from_json("{\"value\":+1}", object), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::from_json("{\"value\":01}", object), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::from_json("{\"value\":-}", object), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::from_json("{\"readonly\":1.}", object), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::from_json("{\"unknown\":.5}", object), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::from_json("{\"unknown\":1e}", object), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Reading nested objects leaves missing keys untouched.", "[reflect]")
+{
+	// Arrange.
+	test_segment segment{ { 1, 2.0f }, { 3, 4.0f }, "label", true };
+	test_marker marker;
+	marker.set_origin({ 5, 6.0f });
+
+	// Act.
+	reflect::from_json("{\"end\":{\"y\":8.5}}", segment);
+	reflect::from_json("{\"origin\":{\"x\":7}}", marker);
+
+	// Assert.
+	REQUIRE(segment.end.x == 3);
+	REQUIRE(segment.end.y == 8.5f);
+	REQUIRE(segment.start.x == 1);
+	REQUIRE(marker.get_origin().x == 7);
+	REQUIRE(marker.get_origin().y == 6.0f);
+}
+
+/** Selects a numeric locale for a test, restoring the previous locale once the test ends, even if it throws. */
+class numeric_locale_guard final
+{
+public:
+	numeric_locale_guard() : m_previous(std::setlocale(LC_NUMERIC, nullptr)) {}
+	~numeric_locale_guard() { std::setlocale(LC_NUMERIC, m_previous.c_str()); }
+
+	/** @returns True if an installed locale using a comma as its decimal separator was selected. */
+	bool select_comma_locale()
+	{
+		for (const char* name : { "de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8", "nl_NL.UTF-8", "ru_RU.UTF-8" })
+		{
+			if (std::setlocale(LC_NUMERIC, name) != nullptr && std::strcmp(std::localeconv()->decimal_point, ",") == 0)
+			{
+				return true;
+			}
+		}
+
+		std::setlocale(LC_NUMERIC, m_previous.c_str());
+		return false;
+	}
+
+private:
+	std::string m_previous;
+};
+
+/**********************************************************/
+TEST_CASE("Numbers are written and read with a point whatever the locale.", "[reflect]")
+{
+	// Arrange.
+	numeric_locale_guard locale;
+	if (!locale.select_comma_locale())
+	{
+		WARN("Skipped, as no locale using a comma as its decimal separator is installed.");
+		return;
+	}
+	test_segment segment{ { 1, 2.5f }, { -3, 0.5f }, "label", true };
+	test_segment read;
+
+	// Act.
+	const std::string json = reflect::to_json(segment);
+	reflect::from_json(json, read);
+
+	// Assert.
+	REQUIRE(json == "{\"start\":{\"x\":1,\"y\":2.5},\"end\":{\"x\":-3,\"y\":0.5},\"label\":\"label\",\"visible\":true}");
+	REQUIRE(read.start.y == 2.5f);
+	REQUIRE(read.end.y == 0.5f);
+}
+
+/**********************************************************/
+TEST_CASE("Writing only the dirty properties as JSON.", "[reflect]")
+{
+	// Arrange.
+	test_segment segment{ { 1, 2.5f }, { -3, 0.5f }, "label", true };
+	reflect::dirty_set<test_segment> dirty;
+	reflect::meta_class<test_segment> data(segment, dirty);
+	reflect::json_writer writer;
+	reflect::json_writer clean_writer;
+
+	// Act.
+	data.set_member<bool>("visible", false);
+	data.set_member<int>("end.x", 4);
+	writer.write_dirty(segment, dirty);
+	clean_writer.write_dirty(segment, dirty);
+
+	// Assert.
+	REQUIRE(writer.str() == "{\"end\":{\"x\":4,\"y\":0.5},\"visible\":false}");
+	REQUIRE(clean_writer.str() == "{}");
+	REQUIRE_FALSE(dirty.any());
+}
\ No newline at end of file
@@ -21,9 +21,33 @@
 */
 
 #define CATCH_CONFIG_MAIN
-#include <catch.hpp>            // Unit-testing framework.
-#include "test_object.hpp"      // Test object.
-#include <reflect/reflect.hpp>  // Reflect framework.
+#include <catch.hpp>               // Unit-testing framework.
+#include <sstream>                 // Formatting visited values.
+#include <unordered_set>           // Hashing objects in unordered containers.
+#include "test_object.hpp"         // Test object.
+#include <reflect/reflect.hpp>     // Reflect framework.
+#include <reflect/algorithms.hpp>  // Copying and comparing members.
+#include <reflect/batch.hpp>       // Gathering and scattering members.
+#include <reflect/soa_vector.hpp>  // Storing objects as columns.
+#include <reflect/hash.hpp>        // Hashing objects.
+#include <reflect/patch.hpp>       // Diffing and patching objects.
+#include <reflect/registry.hpp>    // Looking up classes by name.
+#include <reflect/meta_object.hpp> // Accessing objects of any class.
+#include <reflect/value.hpp>       // Holding values of any type.
+
+namespace std
+{
+	template <>
+	struct hash<test_palette> : reflect::hasher<test_palette> {};
+}
+
+/** Checks whether a property can be named with a value of the type. */
+template <typename S, typename = void>
+struct accepts_property_name : std::false_type {};
+
+/** Checks whether a property can be named with a value of the type. */
+template <typename S>
+struct accepts_property_name<S, decltype(void(reflect::property(std::declval<S>(), &test_point::x)))> : std::true_type {};
 
 /**********************************************************/
 TEST_CASE("Check class is registered.", "[reflect]")
@@ -142,4 +166,904 @@ TEST_CASE("Setting value on readonly variable.", "[reflect]")
 
     // Assert.
 	REQUIRE_THROWS_AS(data.set_member<float>("readonly", 1.0f), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Checking unregistered members do not exist.", "[reflect]")
+{
+	// Arrange.
+	test_object object;
+	reflect::meta_class<test_object> data(object);
+
+	// Assert.
+	REQUIRE(!data.has_member("missing"));
+	REQUIRE(!data.has_member(""));
+	REQUIRE(!data.has_member("valu"));
+}
+
+/**********************************************************/
+TEST_CASE("Getting unregistered variable returns default value.", "[reflect]")
+{
+	// Arrange.
+	test_object object;
+	object.set_value(10);
+	reflect::meta_class<test_object> data(object);
+
+	// Act.
+	int value = data.get_member<int>("missing");
+
+	// Assert.
+	REQUIRE(value == int());
+}
+
+/**********************************************************/
+TEST_CASE("Getting and setting variables through a resolved handle.", "[reflect]")
+{
+	// Arrange.
+	test_object first;
+	test_object second;
+	first.set_value(10);
+	second.set_value(20);
+
+	// Act.
+	auto handle = reflect::meta_class<test_object>::resolve<int>("value");
+	handle.set(second, handle.get(first) + 5);
+
+	// Assert.
+	REQUIRE(handle.is_valid());
+	REQUIRE(handle.get(first) == 10);
+	REQUIRE(second.get_value() == 15);
+}
+
+/**********************************************************/
+TEST_CASE("Resolving handles for unregistered or mismatched variables.", "[reflect]")
+{
+	// Arrange.
+	test_object object;
+	reflect::member_handle<test_object, int> unbound;
+
+	// Act.
+	auto handle = reflect::meta_class<test_object>::resolve<int>("missing");
+
+	// Assert.
+	REQUIRE(!handle);
+	REQUIRE_THROWS_AS(handle.get(object), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(handle.set(object, 1), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(unbound.get(object), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::meta_class<test_object>::resolve<float>("value"), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::meta_class<test_object>::resolve<float>("readonly").set(object, 1.0f), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Getting and setting variables bound to member pointers.", "[reflect]")
+{
+	// Arrange.
+	test_point point{ 1, 2.0f };
+	reflect::meta_class<test_point> data(point);
+
+	// Act.
+	data.set_member<int>("x", 5);
+	data.set_member<float>("y", 7.5f);
+
+	// Assert.
+	REQUIRE(point.x == 5);
+	REQUIRE(point.y == 7.5f);
+	REQUIRE(data.get_member<int>("x") == 5);
+}
+
+/**********************************************************/
+TEST_CASE("Checking the accessor kind of each property.", "[reflect]")
+{
+	// Arrange.
+	test_object object;
+	auto member = reflect::property("x", &test_point::x);
+	auto getter = reflect::property("readonly", &test_object::get_readonly);
+	auto ref_getter = reflect::property("string", &test_object::get_string, &test_object::set_string);
+
+	// Assert.
+	REQUIRE(member.has_member());
+	REQUIRE(!member.has_getter());
+	REQUIRE(!getter.has_setter());
+	REQUIRE(getter.has_getter());
+	REQUIRE(!getter.can_get_const_ref());
+	REQUIRE(ref_getter.can_get_const_ref());
+	REQUIRE(std::is_same<decltype(getter.get(object)), float>::value);
+	REQUIRE(std::is_same<decltype(ref_getter.get(object)), const std::string&>::value);
+	REQUIRE_THROWS_AS(getter.set(object, 1.0f), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(getter.get_reference(object), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Registering properties as a constant expression.", "[reflect]")
+{
+	// Arrange.
+	constexpr auto members = reflect::register_class<test_point>();
+
+	// Assert.
+	REQUIRE(std::is_trivially_destructible<decltype(members)>::value);
+	REQUIRE(std::get<0>(members).get_name() == "x");
+	REQUIRE(std::get<1>(members).get_name() == reflect::string_view("y"));
+}
+
+/**********************************************************/
+struct test_visitor
+{
+	int value;
+	const std::string* address;
+
+	void operator()(int member) { value = member; }
+	void operator()(const std::string& member) { address = &member; }
+	template <typename U> void operator()(const U&) {}
+};
+
+/**********************************************************/
+TEST_CASE("Visiting variables through meta-class.", "[reflect]")
+{
+	// Arrange.
+	test_object object;
+	object.set_value(10);
+	object.set_string("word");
+	reflect::meta_class<test_object> data(object);
+	test_visitor visitor{ 0, nullptr };
+
+	// Act.
+	bool found = data.visit_member("string", visitor) && data.visit_member("value", visitor);
+	bool missing = data.visit_member("missing", visitor);
+
+	// Assert.
+	REQUIRE(found);
+	REQUIRE(!missing);
+	REQUIRE(visitor.address == &object.get_string());
+	REQUIRE(visitor.value == 10);
+}
+
+/**********************************************************/
+TEST_CASE("Moving variables through meta-class.", "[reflect]")
+{
+	// Arrange.
+	test_blob blob;
+	reflect::meta_class<test_blob> data(blob);
+	std::vector<int> moved(1024, 7);
+	const int* buffer = moved.data();
+	std::vector<int> copied(16, 3);
+
+	// Act.
+	data.set_member<std::vector<int>>("data", std::move(moved));
+	const int* after_move = blob.get_data().data();
+	data.set_member<std::vector<int>>("data", copied);
+
+	// Assert.
+	REQUIRE(after_move == buffer);
+	REQUIRE(copied.size() == 16);
+	REQUIRE(blob.get_data() == copied);
+}
+
+/**********************************************************/
+TEST_CASE("Moving variables through member handle.", "[reflect]")
+{
+	// Arrange.
+	test_blob blob;
+	auto handle = reflect::meta_class<test_blob>::resolve<std::vector<int>>("data");
+	std::vector<int> moved(1024, 7);
+	const int* buffer = moved.data();
+
+	// Act.
+	handle.set(blob, std::move(moved));
+
+	// Assert.
+	REQUIRE(blob.get_data().data() == buffer);
+}
+
+/**********************************************************/
+TEST_CASE("Getting variables through meta-class without throwing.", "[reflect]")
+{
+	// Arrange.
+	test_object object;
+	object.set_value(10);
+	reflect::meta_class<test_object> data(object);
+	int value = 0;
+	float mismatch = 1.0f;
+
+	// Act.
+	reflect::member_status found = data.try_get_member("value", value);
+	reflect::member_status missing = data.try_get_member("missing", value);
+	reflect::member_status mismatched = data.try_get_member("value", mismatch);
+
+	// Assert.
+	REQUIRE(found == reflect::member_status::found);
+	REQUIRE(missing == reflect::member_status::not_found);
+	REQUIRE(mismatched == reflect::member_status::type_mismatch);
+	REQUIRE(value == 10);
+	REQUIRE(mismatch == 1.0f);
+}
+
+/**********************************************************/
+TEST_CASE("Setting variables through meta-class without throwing.", "[reflect]")
+{
+	// Arrange.
+	test_object object;
+	reflect::meta_class<test_object> data(object);
+
+	// Act.
+	reflect::member_status found = data.try_set_member<int>("value", 5);
+	reflect::member_status missing = data.try_set_member<int>("missing", 6);
+	reflect::member_status mismatched = data.try_set_member<float>("value", 7.0f);
+	reflect::member_status read_only = data.try_set_member<float>("readonly", 8.0f);
+
+	// Assert.
+	REQUIRE(found == reflect::member_status::found);
+	REQUIRE(missing == reflect::member_status::not_found);
+	REQUIRE(mismatched == reflect::member_status::type_mismatch);
+	REQUIRE(read_only == reflect::member_status::read_only);
+	REQUIRE(object.get_value() == 5);
+	REQUIRE_THROWS_AS(data.set_member<float>("readonly", 8.0f), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(data.set_member<float>("value", 7.0f), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+enum class eSparse
+{
+	LOW = -5,
+	MID = 10,
+	HIGH = 1000
+};
+
+/**********************************************************/
+struct test_sparse
+{
+	eSparse value;
+};
+
+/**********************************************************/
+TEST_CASE("Converting enums through compile time tables.", "[reflect]")
+{
+	// Arrange.
+	constexpr auto dense = reflect::enum_property("colour", &test_object::get_colour, &test_object::set_colour)
+		.set_value("Red", eColour::RED)
+		.set_value("Green", eColour::GREEN)
+		.set_value("Blue", eColour::BLUE);
+	constexpr auto sparse = reflect::enum_property("value", &test_sparse::value)
+		.set_value("High", eSparse::HIGH)
+		.set_value("Low", eSparse::LOW)
+		.set_value("Mid", eSparse::MID);
+	const std::string input = "Mid";
+
+	// Act.
+	reflect::string_view green = dense.to_string(eColour::GREEN);
+	eColour blue = dense.from_string("Blue");
+	reflect::string_view low = sparse.to_string(eSparse::LOW);
+	eSparse mid = sparse.from_string(input);
+
+	// Assert.
+	REQUIRE(green == "Green");
+	REQUIRE(blue == eColour::BLUE);
+	REQUIRE(low == "Low");
+	REQUIRE(mid == eSparse::MID);
+	REQUIRE_THROWS_AS(dense.from_string("Purple"), std::out_of_range);
+	REQUIRE_THROWS_AS(sparse.to_string(static_cast<eSparse>(11)), std::out_of_range);
+}
+
+/**********************************************************/
+TEST_CASE("Enum names registered by different classes are independent.", "[reflect]")
+{
+	// Arrange.
+	test_object object;
+	test_palette palette{ eColour::RED };
+	reflect::meta_class<test_object> object_data(object);
+	reflect::meta_class<test_palette> palette_data(palette);
+
+	// Act.
+	object_data.set_enum_member_from_string<eColour>("colour", "Green");
+	palette_data.set_enum_member_from_string<eColour>("primary", "blue");
+
+	// Assert.
+	REQUIRE(object_data.get_enum_member_as_string<eColour>("colour") == "Green");
+	REQUIRE(palette_data.get_enum_member_as_string<eColour>("primary") == "blue");
+	REQUIRE_THROWS_AS(palette_data.set_enum_member_from_string<eColour>("primary", "Green"), std::out_of_range);
+	REQUIRE_THROWS_AS(object_data.set_enum_member_from_string<eColour>("colour", "blue"), std::out_of_range);
+}
+
+/**********************************************************/
+TEST_CASE("Temporary strings are rejected as property names.", "[reflect]")
+{
+	// Assert.
+	REQUIRE(accepts_property_name<const char*>::value);
+	REQUIRE(accepts_property_name<const std::string&>::value);
+	REQUIRE(!accepts_property_name<std::string>::value);
+}
+
+/**********************************************************/
+TEST_CASE("Converting enums alongside nested enums of the same type.", "[reflect]")
+{
+	// Arrange.
+	test_swatch swatch{ { eColour::RED }, eColour::RED };
+	reflect::meta_class<test_swatch> data(swatch);
+
+	// Act.
+	data.set_enum_member_from_string<eColour>("accent", "green");
+	data.set_enum_member_from_string<eColour>("palette.primary", "blue");
+
+	// Assert.
+	REQUIRE(swatch.accent == eColour::GREEN);
+	REQUIRE(swatch.palette.primary == eColour::BLUE);
+	REQUIRE(data.get_enum_member_as_string<eColour>("accent") == "green");
+	REQUIRE(data.get_enum_member_as_string<eColour>("palette.primary") == "blue");
+}
+
+/**********************************************************/
+TEST_CASE("Plain structs with direct members are detected as bitwise.", "[reflect]")
+{
+	// Arrange.
+	using reflect::detail::bitwise_traits;
+
+	// Act.
+	const std::vector<reflect::detail::byte_range>& point = reflect::detail::bitwise_ranges<test_point>();
+	const std::vector<reflect::detail::byte_range>& tagged = reflect::detail::bitwise_ranges<test_tagged>();
+
+	// Assert.
+	REQUIRE(bitwise_traits<test_point>::copyable);
+	REQUIRE_FALSE(bitwise_traits<test_point>::comparable);
+	REQUIRE(bitwise_traits<test_tagged>::copyable);
+	REQUIRE_FALSE(bitwise_traits<test_segment>::copyable);
+	REQUIRE_FALSE(bitwise_traits<test_object>::copyable);
+	REQUIRE(bitwise_traits<test_palette>::comparable);
+	REQUIRE(point.size() == 1);
+	REQUIRE(point[0].size == sizeof(test_point));
+	REQUIRE(reflect::detail::is_bitwise_packed<test_point>());
+	REQUIRE_FALSE(reflect::detail::is_bitwise_packed<test_tagged>());
+	REQUIRE(tagged.size() == 2);
+	REQUIRE(tagged[0].size == sizeof(char));
+	REQUIRE(tagged[1].offset == offsetof(test_tagged, id));
+	REQUIRE(tagged[1].size == sizeof(int) + sizeof(test_point));
+}
+
+/**********************************************************/
+TEST_CASE("Copying and comparing the members of objects.", "[reflect]")
+{
+	// Arrange.
+	test_tagged tagged{ 'a', 1, { 2, 3.0f } };
+	test_tagged tagged_copy{ 'b', 0, { 0, 0.0f } };
+	test_segment segment{ { 1, 2.5f }, { -3, 0.5f }, "label", true };
+	test_segment segment_copy{ { 0, 0.0f }, { 0, 0.0f }, "", false };
+	test_object object;
+	object.set_value(5);
+	object.set_string("text");
+	test_object object_copy;
+
+	// Act.
+	reflect::copy_members(tagged, tagged_copy);
+	reflect::copy_members(segment, segment_copy);
+	reflect::copy_members(object, object_copy);
+
+	// Assert.
+	REQUIRE(tagged_copy.tag == 'a');
+	REQUIRE(tagged_copy.id == 1);
+	REQUIRE(tagged_copy.point.y == 3.0f);
+	REQUIRE(reflect::members_equal(tagged, tagged_copy));
+	REQUIRE(reflect::members_equal(segment, segment_copy));
+	REQUIRE(reflect::members_equal(object, object_copy));
+	segment_copy.end.y = -0.5f;
+	REQUIRE_FALSE(reflect::members_equal(segment, segment_copy));
+	REQUIRE(reflect::members_equal(test_point{ 0, 0.0f }, test_point{ 0, -0.0f }));
+}
+
+/**********************************************************/
+TEST_CASE("Visiting the leaf members of nested registered classes.", "[reflect]")
+{
+	// Arrange.
+	test_segment segment{ { 1, 2.5f }, { -3, 0.5f }, "label", true };
+	reflect::meta_class<test_segment> data(segment);
+	std::vector<std::string> paths;
+	std::ostringstream values;
+
+	// Act.
+	data.for_each_deep([&paths, &values](reflect::string_view path, const auto& value) {
+		paths.push_back(path);
+		values << value << ' ';
+	});
+
+	// Assert.
+	REQUIRE(paths == std::vector<std::string>{ "start.x", "start.y", "end.x", "end.y", "label", "visible" });
+	REQUIRE(values.str() == "1 2.5 -3 0.5 label 1 ");
+}
+
+/**********************************************************/
+TEST_CASE("Accessing nested members by dotted paths.", "[reflect]")
+{
+	// Arrange.
+	test_segment segment{ { 1, 2.5f }, { -3, 0.5f }, "label", true };
+	test_marker marker;
+	reflect::meta_class<test_segment> segment_data(segment);
+	reflect::meta_class<test_marker> marker_data(marker);
+	int missing = 0;
+
+	// Act.
+	int start_x = segment_data.get_member<int>("start.x");
+	segment_data.set_member<float>("end.y", 4.0f);
+	marker_data.set_member<int>("origin.x", 7);
+
+	// Assert.
+	REQUIRE(start_x == 1);
+	REQUIRE(segment.end.y == 4.0f);
+	REQUIRE(marker.get_origin().x == 7);
+	REQUIRE(segment_data.has_member("start.y"));
+	REQUIRE_FALSE(segment_data.has_member("start.z"));
+	REQUIRE(segment_data.try_get_member("start.z", missing) == reflect::member_status::not_found);
+	REQUIRE(segment_data.try_get_member("label.x", missing) == reflect::member_status::not_found);
+	REQUIRE(segment_data.try_set_member<int>("start.y", 1) == reflect::member_status::type_mismatch);
+	REQUIRE_THROWS_AS(segment_data.get_member<float>("start.x"), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Resolving dotted paths into handles.", "[reflect]")
+{
+	// Arrange.
+	test_segment segment{ { 1, 2.5f }, { -3, 0.5f }, "label", true };
+	test_marker marker;
+
+	// Act.
+	auto end_x = reflect::meta_class<test_segment>::resolve<int>("end.x");
+	auto origin_y = reflect::meta_class<test_marker>::resolve<float>("origin.y");
+	end_x.set(segment, end_x.get(segment) * 2);
+	origin_y.set(marker, 1.5f);
+
+	// Assert.
+	REQUIRE(end_x.is_valid());
+	REQUIRE(segment.end.x == -6);
+	REQUIRE(marker.get_origin().y == 1.5f);
+	REQUIRE_FALSE(reflect::meta_class<test_segment>::resolve<int>("end.z").is_valid());
+}
+
+/**********************************************************/
+TEST_CASE("Spans only convert between elements of the same type.", "[reflect]")
+{
+	// Arrange.
+	struct base { int value; };
+	struct derived : base { int extra; };
+
+	// Assert.
+	REQUIRE(std::is_convertible<std::vector<int>&, reflect::span<const int>>::value);
+	REQUIRE(std::is_convertible<const std::vector<int>&, reflect::span<const int>>::value);
+	REQUIRE(std::is_convertible<reflect::span<int>, reflect::span<const int>>::value);
+	REQUIRE(!std::is_convertible<const std::vector<int>&, reflect::span<int>>::value);
+	REQUIRE(!std::is_convertible<std::vector<derived>&, reflect::span<base>>::value);
+	REQUIRE(!std::is_convertible<reflect::span<derived>, reflect::span<const base>>::value);
+}
+
+/**********************************************************/
+TEST_CASE("Gathering a member variable across a span of objects.", "[reflect]")
+{
+	// Arrange.
+	std::vector<test_point> points{ { 1, 0.5f }, { 2, 1.5f }, { 3, 2.5f } };
+	std::vector<test_marker> markers(2);
+	markers[1].set_origin({ 4, 5.0f });
+	std::vector<int> xs(points.size());
+	std::vector<float> ys(markers.size());
+
+	// Act.
+	reflect::gather<int>(reflect::make_span(points), "x", xs);
+	reflect::gather<float>(reflect::make_span(markers), "origin.y", ys);
+
+	// Assert.
+	REQUIRE(xs == std::vector<int>({ 1, 2, 3 }));
+	REQUIRE(ys == std::vector<float>({ 0.0f, 5.0f }));
+	REQUIRE_THROWS_AS(reflect::gather<int>(reflect::make_span(points), "z", xs), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::gather<float>(reflect::make_span(markers), "origin.x", ys), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::gather<int>(reflect::make_span(points), "x", reflect::span<int>(xs.data(), 1)), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Scattering values into a member variable across a span of objects.", "[reflect]")
+{
+	// Arrange.
+	std::vector<test_point> points(3);
+	std::vector<test_marker> markers(2);
+	const std::vector<int> xs{ 4, 5, 6 };
+	const std::vector<float> ys{ 1.5f, 2.5f };
+	const std::vector<int> layers{ 1, 2 };
+
+	// Act.
+	reflect::scatter<int>(reflect::make_span(points), "x", xs);
+	reflect::scatter<float>(reflect::make_span(markers), "origin.y", ys);
+
+	// Assert.
+	REQUIRE(points[0].x == 4);
+	REQUIRE(points[2].x == 6);
+	REQUIRE(markers[0].get_origin().y == 1.5f);
+	REQUIRE(markers[1].get_origin().y == 2.5f);
+	REQUIRE_THROWS_AS(reflect::scatter<int>(reflect::make_span(markers), "layer", layers), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(reflect::scatter<int>(reflect::make_span(points), "x", layers), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Storing objects as columns.", "[reflect]")
+{
+	// Arrange.
+	reflect::soa_vector<test_point> points;
+	points.push_back({ 1, 0.5f });
+	points.push_back({ 2, 1.5f });
+	points.push_back({ 3, 2.5f });
+	float sum = 0.0f;
+	std::size_t count = 0;
+	int read_only = 0;
+
+	// Act.
+	reflect::span<int> xs = points.column<int>("x");
+	xs[0] = 10;
+	points[1].set_member<float>("y", 4.0f);
+	points[1].set_member<int>("z", 5);
+	points.set(2, { 7, 8.0f });
+	points[1].for_each_value([&sum](const auto&, auto& value) {
+		sum += static_cast<float>(value);
+	});
+	points[2].for_each_value([](const auto&, auto& value) {
+		value *= 2;
+	});
+	points[1].for_each([&count](const auto&) {
+		++count;
+	});
+	const reflect::soa_vector<test_point>::row first = points[0];
+	first.for_each_value([&read_only](const auto&, auto& value) {
+		read_only += std::is_const<std::remove_reference_t<decltype(value)>>::value ? 1 : 2;
+	});
+
+	// Assert.
+	REQUIRE(points.size() == 3);
+	REQUIRE(points.get(0).x == 10);
+	REQUIRE(points[1].get_member<float>("y") == 4.0f);
+	REQUIRE(points.column<0>()[2] == 14);
+	REQUIRE(points.column<1>()[2] == 16.0f);
+	REQUIRE(sum == 6.0f);
+	REQUIRE(count == 2);
+	REQUIRE(read_only == 2);
+	REQUIRE(points[0].get_member<int>("z") == 0);
+	REQUIRE_THROWS_AS(points.column<float>("x"), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(points[0].get_member<float>("x"), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(points.column<int>("z"), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Hashing registered classes.", "[reflect]")
+{
+	// Arrange.
+	test_segment segment{ { 1, 0.0f }, { 2, 3.5f }, "label", true };
+	test_segment negative_zero{ { 1, -0.0f }, { 2, 3.5f }, "label", true };
+	test_segment relabelled{ { 1, 0.0f }, { 2, 3.5f }, "other", true };
+	test_palette red{ eColour::RED };
+	test_palette blue{ eColour::BLUE };
+
+	// Act.
+	std::unordered_set<test_palette, std::hash<test_palette>, bool(*)(const test_palette&, const test_palette&)> palettes(4, std::hash<test_palette>(),
+		[](const test_palette& lhs, const test_palette& rhs) { return reflect::members_equal(lhs, rhs); });
+	palettes.insert(red);
+	palettes.insert(blue);
+	palettes.insert(test_palette{ eColour::RED });
+
+	// Assert.
+	REQUIRE(reflect::hash(segment) == reflect::hash(negative_zero));
+	REQUIRE(reflect::hash(segment) != reflect::hash(relabelled));
+	REQUIRE(reflect::hash(red) != reflect::hash(blue));
+	REQUIRE(std::hash<test_palette>()(red) == reflect::hash(red));
+	REQUIRE(palettes.size() == 2);
+}
+
+/**********************************************************/
+TEST_CASE("Diffing and patching objects.", "[reflect]")
+{
+	// Arrange.
+	const test_segment before{ { 1, 2.0f }, { 3, 4.0f }, "label", true };
+	test_segment after = before;
+	after.end.y = 5.0f;
+	after.label = "moved";
+	test_segment replica = before;
+
+	// Act.
+	reflect::patch<test_segment> changes = reflect::diff(before, after);
+	reflect::patch<test_segment> received(changes.data(), changes.size());
+	reflect::apply(received, replica);
+
+	// Assert.
+	REQUIRE_FALSE(changes.empty());
+	REQUIRE(reflect::diff(before, before).empty());
+	REQUIRE(reflect::members_equal(replica, after));
+	REQUIRE(changes.size() < reflect::to_binary(after).size());
+	REQUIRE_THROWS_AS(reflect::apply(reflect::patch<test_segment>(changes.data(), changes.size() - 1), replica), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Malformed patches are not partially applied.", "[reflect]")
+{
+	// Arrange.
+	const test_segment before{ { 1, 2.0f }, { 3, 4.0f }, "label", true };
+	test_segment after = before;
+	after.end.y = 5.0f;
+	after.label = "moved";
+	test_segment replica = before;
+	const reflect::patch<test_segment> changes = reflect::diff(before, after);
+	test_object object;
+	test_object changed;
+	changed.set_value(99);
+	const reflect::patch<test_object> value_change = reflect::diff(object, changed);
+
+	// Act.
+	const reflect::patch<test_segment> truncated(changes.data(), changes.size() - 1);
+	std::vector<char> bytes(value_change.data(), value_change.data() + value_change.size());
+	const char readonly_change[] = { 2, 0, 0, 0, 0, 0, 0, 0 };
+	bytes.insert(bytes.end(), readonly_change, readonly_change + sizeof(readonly_change));
+	const reflect::patch<test_object> readonly(bytes.data(), bytes.size());
+
+	// Assert.
+	REQUIRE_THROWS_AS(reflect::apply(truncated, replica), reflect::detail::meta_exception);
+	REQUIRE(reflect::members_equal(replica, before));
+	REQUIRE_THROWS_AS(reflect::apply(readonly, object), reflect::detail::meta_exception);
+	REQUIRE(object.get_value() == 0);
+}
+
+/**********************************************************/
+TEST_CASE("Looking up registered classes by name.", "[reflect]")
+{
+	// Arrange.
+	const bool added = reflect::registry::add<test_point>() && reflect::registry::add<test_segment>();
+	const test_point point{ 3, 1.5f };
+	reflect::binary_writer writer;
+	int sum = 0;
+
+	// Act.
+	const reflect::meta_type* type = reflect::registry::find("test_point");
+	type->serialize(&point, writer);
+	void* object = type->construct();
+	reflect::binary_reader reader(writer.data(), writer.size());
+	type->deserialize(object, reader);
+	type->for_each(object, &sum, [](void* context, reflect::string_view, const void* value, const void* key) {
+		if (key == reflect::type_key<int>())
+		{
+			*static_cast<int*>(context) += *static_cast<const int*>(value);
+		}
+	});
+	const int x = static_cast<test_point*>(object)->x;
+	type->destroy(object);
+
+	// Assert.
+	REQUIRE(added);
+	REQUIRE(type == &reflect::get_meta_type<test_point>());
+	REQUIRE(reflect::registry::find(reflect::type_id<test_segment>())->name == "test_segment");
+	REQUIRE(reflect::registry::find("test_missing") == nullptr);
+	REQUIRE(x == 3);
+	REQUIRE(sum == 3);
+}
+
+/**********************************************************/
+TEST_CASE("Accessing objects of different classes through meta objects.", "[reflect]")
+{
+	// Arrange.
+	test_point point{ 1, 2.0f };
+	test_segment segment{ { 3, 4.0f }, { 5, 6.0f }, "label", true };
+	test_object object;
+	std::vector<reflect::meta_object> objects{ reflect::meta_object(point), reflect::meta_object(segment), reflect::meta_object(object) };
+	std::string names;
+
+	// Act.
+	objects[0].set_member<int>("x", 7);
+	objects[1].set_member<int>("end.x", 8);
+	objects[1].set_member_at<std::string>(2, "moved");
+	objects[1].for_each([&names](reflect::string_view name, const void*, const void*) {
+		names += name.to_string() + ",";
+	});
+	int value = 0;
+	const reflect::member_status missing = objects[2].try_get_member("missing", value);
+
+	// Assert.
+	REQUIRE(point.x == 7);
+	REQUIRE(segment.end.x == 8);
+	REQUIRE(segment.label == "moved");
+	REQUIRE(objects[1].get_member_at<bool>(3));
+	REQUIRE(objects[0].get_member<float>("y") == 2.0f);
+	REQUIRE(names == "start,end,label,visible,");
+	REQUIRE(missing == reflect::member_status::not_found);
+	REQUIRE(objects[1].visit_member("start.y", [](reflect::string_view, const void*, const void*) {}));
+	REQUIRE_THROWS_AS(objects[0].get_member<int>("y"), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(objects[2].set_member<float>("readonly", 1.0f), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(objects[0].get_member_at<int>(2), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Holding values of any type.", "[reflect]")
+{
+	// Arrange.
+	reflect::value empty;
+	reflect::value number(42);
+	reflect::value label("label");
+	reflect::value segment(test_segment{ { 1, 2.0f }, { 3, 4.0f }, "segment", true });
+
+	// Act.
+	reflect::value copy(segment);
+	reflect::value moved(std::move(label));
+	number = copy;
+
+	// Assert.
+	REQUIRE(empty.empty());
+	REQUIRE(label.empty());
+	REQUIRE(moved.get<std::string>() == "label");
+	REQUIRE(moved.is_inline());
+	REQUIRE(!segment.is_inline());
+	REQUIRE(number.get<test_segment>().label == "segment");
+	REQUIRE(copy.get<test_segment>().end.x == 3);
+	REQUIRE(copy.type() == reflect::type_key<test_segment>());
+	REQUIRE(reflect::value(eColour::BLUE).is<eColour>());
+	REQUIRE(reflect::value(1.5).is_inline());
+	REQUIRE(moved.get_if<int>() == nullptr);
+	REQUIRE_THROWS_AS(moved.get<int>(), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Getting and setting members as values.", "[reflect]")
+{
+	// Arrange.
+	test_segment segment{ { 1, 2.0f }, { 3, 4.0f }, "label", true };
+	test_object object;
+	test_blob blob;
+	reflect::meta_class<test_segment> data(segment);
+	reflect::meta_class<test_object> object_data(object);
+
+	// Act.
+	const reflect::value label = data.get_value("label");
+	const reflect::value start_x = data.get_value("start.x");
+	data.set_value("end.y", 8.0f);
+	data.set_value("label", "renamed");
+	object_data.set_value("colour", eColour::GREEN);
+	reflect::meta_class<test_blob>(blob).set_value("data", std::vector<int>{ 1, 2 });
+
+	// Assert.
+	REQUIRE(label.get<std::string>() == "label");
+	REQUIRE(start_x.get<int>() == 1);
+	REQUIRE(segment.end.y == 8.0f);
+	REQUIRE(segment.label == "renamed");
+	REQUIRE(object.get_colour() == eColour::GREEN);
+	REQUIRE(object_data.get_value("colour").get<eColour>() == eColour::GREEN);
+	REQUIRE(blob.get_data().size() == 2);
+	REQUIRE(data.get_value("missing").empty());
+	REQUIRE(data.try_set_value("missing", 1) == reflect::member_status::not_found);
+	REQUIRE(data.try_set_value("end.x", 1.0) == reflect::member_status::type_mismatch);
+	REQUIRE_THROWS_AS(data.set_value("visible", 1), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(object_data.set_value("readonly", 1.0f), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Getting and setting type-erased members as values.", "[reflect]")
+{
+	// Arrange.
+	test_segment segment{ { 1, 2.0f }, { 3, 4.0f }, "label", true };
+	const reflect::meta_object object(segment);
+
+	// Act.
+	object.set_value("start.x", 5);
+	const reflect::value visible = object.get_value("visible");
+
+	// Assert.
+	REQUIRE(segment.start.x == 5);
+	REQUIRE(visible.get<bool>());
+	REQUIRE(object.get_value("start").get<test_point>().x == 5);
+	REQUIRE(object.try_set_value("label", reflect::value()) == reflect::member_status::type_mismatch);
+	REQUIRE_THROWS_AS(object.set_value("missing", 1), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Type-erased access does not require construction or archiving.", "[reflect]")
+{
+	// Arrange.
+	test_counter counter(3);
+	counter.counts["a"] = 1;
+	const reflect::meta_object object(counter);
+	const reflect::meta_type& type = object.get_type();
+	reflect::binary_writer writer;
+
+	// Act.
+	object.set_member<int>("id", 4);
+	const reflect::value counts = object.get_value("counts");
+
+	// Assert.
+	REQUIRE(counter.id == 4);
+	REQUIRE(counts.get<std::map<std::string, int>>().at("a") == 1);
+	REQUIRE(reflect::registry::add<test_counter>());
+	REQUIRE(reflect::registry::find("test_counter") == &type);
+	REQUIRE_THROWS_AS(type.construct(), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(type.serialize(&counter, writer), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Marking set properties as dirty by their position.", "[reflect]")
+{
+	// Arrange.
+	test_swatch swatch{ { eColour::RED }, eColour::RED };
+	test_version version{ 1, 0 };
+	reflect::dirty_set<test_swatch> swatch_dirty;
+	reflect::dirty_set<test_version> version_dirty;
+	reflect::meta_class<test_swatch> swatch_data(swatch, swatch_dirty);
+	reflect::meta_class<test_version> version_data(version, version_dirty);
+
+	// Act.
+	swatch_data.set_enum_member_from_string<eColour>("accent", "blue");
+	version_data.set_member<int>("version.minor", 2);
+
+	// Assert.
+	REQUIRE(swatch_dirty.is_dirty(1));
+	REQUIRE_FALSE(swatch_dirty.is_dirty(0));
+	REQUIRE(version_dirty.is_dirty(1));
+	REQUIRE_FALSE(version_dirty.is_dirty(0));
+	REQUIRE(swatch_dirty.mark("palette.primary"));
+	REQUIRE(swatch_dirty.is_dirty(0));
+	REQUIRE(version_dirty.mark("version.major"));
+	REQUIRE(version_dirty.count() == 2);
+}
+
+/**********************************************************/
+TEST_CASE("Getting members which are not default constructible.", "[reflect]")
+{
+	// Arrange.
+	test_tally tally{ test_counter(5) };
+	reflect::meta_class<test_tally> data(tally);
+
+	// Act.
+	const test_counter counter = data.get_member<test_counter>("counter");
+
+	// Assert.
+	REQUIRE(counter.id == 5);
+	REQUIRE(data.get_member<int>("counter.id") == 5);
+	REQUIRE_THROWS_AS(data.get_member<test_counter>("missing"), reflect::detail::meta_exception);
+}
+
+/**********************************************************/
+TEST_CASE("Dynamic accessors return values from getters by value.", "[reflect]")
+{
+	// Arrange.
+	test_object object;
+	object.set_value(7);
+	const reflect::property_impl<test_object, int> value("value", &test_object::get_value, &test_object::set_value);
+
+	// Act.
+	const auto result = value.get(object);
+
+	// Assert.
+	REQUIRE(std::is_same<decltype(value.get(object)), int>::value);
+	REQUIRE(result == 7);
+	REQUIRE_FALSE(value.can_get_const_ref());
+}
+
+/**********************************************************/
+TEST_CASE("Appending to columns is undone if a copy throws.", "[reflect]")
+{
+	// Arrange.
+	reflect::soa_vector<test_row> rows;
+	rows.push_back({ 1, test_fragile(2) });
+
+	// Act.
+	test_fragile::fail_copies() = true;
+	REQUIRE_THROWS_AS(rows.push_back({ 3, test_fragile(4) }), std::runtime_error);
+	test_fragile::fail_copies() = false;
+
+	// Assert.
+	REQUIRE(rows.size() == 1);
+	REQUIRE(rows.column<int>("id").size() == 1);
+	REQUIRE(rows.column<test_fragile>("payload").size() == 1);
+	REQUIRE(rows.get(0).payload.number == 2);
+}
+
+/**********************************************************/
+TEST_CASE("Accessing members through an empty meta object throws.", "[reflect]")
+{
+	// Arrange.
+	const reflect::meta_object empty;
+	int value = 0;
+
+	// Act.
+	const reflect::member_status status = empty.try_get_member("value", value);
+
+	// Assert.
+	REQUIRE(!empty.is_valid());
+	REQUIRE(status == reflect::member_status::not_found);
+	REQUIRE(empty.try_set_member("value", 1) == reflect::member_status::not_found);
+	REQUIRE_THROWS_AS(empty.get_member<int>("value"), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(empty.set_member("value", 1), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(empty.visit_member("value", [](reflect::string_view, const void*, const void*) {}), reflect::detail::meta_exception);
+	REQUIRE_THROWS_AS(empty.get_type(), reflect::detail::meta_exception);
 }
\ No newline at end of file
@@ -23,7 +23,11 @@
 #ifndef _TEST_OBJECT_HPP_
 #define _TEST_OBJECT_HPP_
 
+#include <map>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 #include <reflect/reflect.hpp>
 
 enum class eColour
@@ -33,6 +37,107 @@ enum class eColour
 	BLUE
 };
 
+struct test_point
+{
+	int   x;
+	float y;
+};
+
+struct test_segment
+{
+	test_point  start;
+	test_point  end;
+	std::string label;
+	bool        visible;
+};
+
+struct test_tagged
+{
+	char       tag;
+	int        id;
+	test_point point;
+};
+
+struct test_path
+{
+	std::vector<test_point> points;
+};
+
+struct test_palette
+{
+	eColour primary;
+};
+
+struct test_swatch
+{
+	test_palette palette;
+	eColour      accent;
+};
+
+class test_marker final
+{
+private:
+	test_point m_origin;
+	int        m_layer;
+
+public:
+	explicit test_marker() : m_origin{ 0, 0.0f }, m_layer(0) {}
+
+	const test_point& get_origin() const { return m_origin; }
+	void set_origin(const test_point& origin) { m_origin = origin; }
+
+	int get_layer() const { return m_layer; }
+};
+
+class test_blob final
+{
+private:
+	std::vector<int> m_data;
+
+public:
+	const std::vector<int>& get_data() const { return m_data; }
+	void set_data(std::vector<int>&& data) { m_data = std::move(data); }
+};
+
+class test_fragile final
+{
+public:
+	static bool& fail_copies() { static bool fail = false; return fail; }
+
+	explicit test_fragile(int number = 0) : number(number) {}
+	test_fragile(const test_fragile& other) : number(other.number) { if (fail_copies()) throw std::runtime_error("Copy failed."); }
+	test_fragile(test_fragile&& other) noexcept = default;
+	test_fragile& operator=(const test_fragile& other) = default;
+	test_fragile& operator=(test_fragile&& other) noexcept = default;
+
+	int number;
+};
+
+struct test_row
+{
+	int          id;
+	test_fragile payload;
+};
+
+struct test_version
+{
+	int major;
+	int minor;
+};
+
+struct test_counter
+{
+	explicit test_counter(int id) : id(id), counts() {}
+
+	int                        id;
+	std::map<std::string, int> counts;
+};
+
+struct test_tally
+{
+	test_counter counter;
+};
+
 class test_object final
 {
 private:
@@ -60,7 +165,120 @@ public:
 namespace reflect
 {
 	template <>
-	inline auto register_class<test_object>()
+	constexpr auto register_class<test_point>()
+	{
+		return properties(
+			property("x", &test_point::x),
+			property("y", &test_point::y)
+		);
+	}
+
+	template <>
+	constexpr auto register_class<test_segment>()
+	{
+		return properties(
+			property("start", &test_segment::start),
+			property("end", &test_segment::end),
+			property("label", &test_segment::label),
+			property("visible", &test_segment::visible)
+		);
+	}
+
+	template <>
+	constexpr auto register_class<test_tagged>()
+	{
+		return properties(
+			property("tag", &test_tagged::tag),
+			property("id", &test_tagged::id),
+			property("point", &test_tagged::point)
+		);
+	}
+
+	template <>
+	constexpr auto register_class<test_path>()
+	{
+		return properties(
+			property("points", &test_path::points)
+		);
+	}
+
+	template <>
+	constexpr auto register_class<test_marker>()
+	{
+		return properties(
+			property("origin", &test_marker::get_origin, &test_marker::set_origin),
+			property("layer", &test_marker::get_layer)
+		);
+	}
+
+	template <>
+	constexpr auto register_class<test_blob>()
+	{
+		return properties(
+			property("data", &test_blob::get_data, &test_blob::set_data)
+		);
+	}
+
+	template <>
+	constexpr auto register_class<test_palette>()
+	{
+		return properties(
+			enum_property("primary", &test_palette::primary)
+				.set_value("red", eColour::RED)
+				.set_value("green", eColour::GREEN)
+				.set_value("blue", eColour::BLUE)
+		);
+	}
+
+	template <>
+	constexpr auto register_class<test_swatch>()
+	{
+		return properties(
+			property("palette", &test_swatch::palette),
+			enum_property("accent", &test_swatch::accent)
+				.set_value("red", eColour::RED)
+				.set_value("green", eColour::GREEN)
+				.set_value("blue", eColour::BLUE)
+		);
+	}
+
+	template <>
+	constexpr auto register_class<test_row>()
+	{
+		return properties(
+			property("id", &test_row::id),
+			property("payload", &test_row::payload)
+		);
+	}
+
+	template <>
+	constexpr auto register_class<test_version>()
+	{
+		return properties(
+			property("version.major", &test_version::major),
+			property("version.minor", &test_version::minor)
+		);
+	}
+
+	template <>
+	constexpr auto register_class<test_counter>()
+	{
+		return properties(
+			property("id", &test_counter::id),
+			property("counts", &test_counter::counts)
+		);
+	}
+
+	template <>
+	constexpr auto register_class<test_tally>()
+	{
+		return properties(
+			property("counter", &test_tally::counter)
+		);
+	}
+
+	template <>
+	constexpr auto register_class<test_object>()
 	{
 		return properties(
 			property("value", &test_object::get_value, &test_object::set_value),
@@ -72,6 +290,24 @@ namespace reflect
 				.set_value("Blue", eColour::BLUE)
 		);
 	}
+
+	template <>
+	inline std::string register_name<test_point>()
+	{
+		return "test_point";
+	}
+
+	template <>
+	inline std::string register_name<test_segment>()
+	{
+		return "test_segment";
+	}
+
+	template <>
+	inline std::string register_name<test_counter>()
+	{
+		return "test_counter";
+	}
 }
 
 #endif//_TEST_OBJECT_HPP_
\ No newline at end of file